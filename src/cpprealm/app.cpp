@@ -9,6 +9,8 @@
 #include <realm/object-store/sync/sync_manager.hpp>
 #include <realm/object-store/sync/sync_user.hpp>
 
+#include <algorithm>
+#include <mutex>
 #include <utility>
 
 namespace realm {
@@ -247,6 +249,108 @@ namespace realm {
         return f;
     }
 
+    namespace {
+        // Feeds a batch of function calls to the app, starting the next queued call as each
+        // one in flight completes.
+        struct function_call_batch : std::enable_shared_from_this<function_call_batch> {
+            using callback_t = std::function<void(size_t, std::optional<bson::Bson>&&, std::optional<app_error>)>;
+
+            function_call_batch(std::shared_ptr<SyncUser> user,
+                                std::vector<std::pair<std::string, realm::bson::BsonArray>> calls,
+                                callback_t callback)
+                : m_user(std::move(user)), m_calls(std::move(calls)), m_callback(std::move(callback)) {}
+
+            void start(size_t max_concurrent) {
+                pump(std::max<size_t>(max_concurrent, 1));
+            }
+
+        private:
+            // Transports may complete a call from within `call_function`, so completions only
+            // hand back their slot, and whichever thread is already pumping starts the next
+            // calls in a loop instead of recursing once per call.
+            void pump(size_t free_slots) {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_free_slots += free_slots;
+                    if (m_pumping) {
+                        return;
+                    }
+                    m_pumping = true;
+                }
+                while (true) {
+                    size_t index;
+                    {
+                        std::lock_guard lock(m_mutex);
+                        if (m_free_slots == 0 || m_next >= m_calls.size()) {
+                            m_pumping = false;
+                            return;
+                        }
+                        --m_free_slots;
+                        index = m_next++;
+                    }
+                    start_call(index);
+                }
+            }
+
+            void start_call(size_t index) {
+                auto app = m_user->sync_manager()->app().lock();
+                auto& [name, arguments] = m_calls[index];
+                app->call_function(m_user, name, arguments, std::nullopt,
+                                   [self = shared_from_this(), index](std::optional<bson::Bson>&& bson,
+                                                                      std::optional<app::AppError> err) {
+                    self->m_callback(index, std::move(bson),
+                                     err ? std::optional<app_error>(app_error(std::move(*err))) : std::nullopt);
+                    self->pump(1);
+                });
+            }
+
+            std::shared_ptr<SyncUser> m_user;
+            std::vector<std::pair<std::string, realm::bson::BsonArray>> m_calls;
+            callback_t m_callback;
+            std::mutex m_mutex;
+            size_t m_next = 0;
+            size_t m_free_slots = 0;
+            bool m_pumping = false;
+        };
+    }
+
+    void user::call_functions(const std::vector<std::pair<std::string, realm::bson::BsonArray>>& calls,
+                              std::function<void(size_t, std::optional<bson::Bson>&&, std::optional<app_error>)> callback,
+                              size_t max_concurrent) const
+    {
+        auto batch = std::make_shared<function_call_batch>(m_user, calls, std::move(callback));
+        batch->start(max_concurrent);
+    }
+
+    std::vector<std::future<std::optional<bson::Bson>>>
+    user::call_functions(const std::vector<std::pair<std::string, realm::bson::BsonArray>>& calls,
+                         size_t max_concurrent) const
+    {
+        auto promises = std::make_shared<std::vector<std::promise<std::optional<bson::Bson>>>>(calls.size());
+        std::vector<std::future<std::optional<bson::Bson>>> futures;
+        futures.reserve(calls.size());
+        for (auto& p : *promises) {
+            futures.push_back(p.get_future());
+        }
+        call_functions(calls, [promises](size_t index, std::optional<bson::Bson>&& bson, std::optional<app_error> err) {
+            if (err) {
+                (*promises)[index].set_exception(std::make_exception_ptr(std::move(*err)));
+            } else {
+                (*promises)[index].set_value(std::move(bson));
+            }
+        }, max_concurrent);
+        return futures;
+    }
+
+    void user::call_function(const std::string& name, std::string_view arguments_ejson,
+                             std::function<void(const std::string*, std::optional<app_error>)> callback) const
+    {
+        m_user->sync_manager()->app().lock()->call_function(m_user, name, arguments_ejson, std::nullopt,
+                                                            [callback = std::move(callback)](const std::string* result, std::optional<app::AppError> err) {
+            callback(result, err ? std::optional<app_error>(app_error(std::move(*err))) : std::nullopt);
+        });
+    }
+
     /**
      Refresh a user's custom data. This will, in effect, refresh the user's auth session.
      */
@@ -428,10 +532,25 @@ namespace realm {
 #endif
         client_config.user_agent_binding_info = std::string("RealmCpp/") + std::string(REALMCXX_VERSION_STRING);
         client_config.user_agent_application_info = config.app_id;
+        client_config.multiplex_sessions = config.multiplex_sessions;
+        if (config.sync_connect_timeout) {
+            client_config.timeouts.connect_timeout = static_cast<uint64_t>(config.sync_connect_timeout->count());
+        }
+        if (config.sync_connection_linger_time) {
+            client_config.timeouts.connection_linger_time = static_cast<uint64_t>(config.sync_connection_linger_time->count());
+        }
 
         auto app_config = app::App::Config();
         app_config.app_id = config.app_id;
+#ifdef CPPREALM_HAVE_CURL
+        if (config.async_transport) {
+            app_config.transport = std::make_shared<internal::CurlMultiTransport>(config.custom_http_headers);
+        } else {
+            app_config.transport = std::make_shared<internal::DefaultTransport>(config.custom_http_headers);
+        }
+#else
         app_config.transport = std::make_shared<internal::DefaultTransport>(config.custom_http_headers);
+#endif
         app_config.base_url = config.base_url;
         auto device_info = app::App::Config::DeviceInfo();
 
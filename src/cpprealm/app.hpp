@@ -30,6 +30,7 @@
 #include <realm/object-store/sync/app_credentials.hpp>
 #include <realm/object-store/util/bson/bson.hpp>
 
+#include <chrono>
 #include <future>
 #include <utility>
 
@@ -187,6 +188,52 @@ struct user {
     [[nodiscard]] std::future<std::optional<bson::Bson>> call_function(const std::string& name,
                                                                        const realm::bson::BsonArray& arguments) const;
 
+    /**
+     Calls many Atlas App Services functions, keeping at most `max_concurrent` calls in flight.
+
+     Calls beyond the window are queued and started as earlier calls complete, so a large batch
+     does not flood the transport; the transport reuses its connections, or multiplexes the
+     calls over one connection where it supports HTTP/2. Calls only overlap when the app was
+     configured with `async_transport`; the default transport completes each call before the
+     next one starts.
+
+     @param calls The name and arguments of each function to call.
+     @param callback Called once per call with its index in `calls`, in completion order.
+     @param max_concurrent The maximum number of calls in flight at once.
+     */
+    void call_functions(const std::vector<std::pair<std::string, realm::bson::BsonArray>>& calls,
+                        std::function<void(size_t, std::optional<bson::Bson>&&, std::optional<app_error>)> callback,
+                        size_t max_concurrent = 8) const;
+
+    /**
+     Calls many Atlas App Services functions, keeping at most `max_concurrent` calls in flight.
+
+     @param calls The name and arguments of each function to call.
+     @param max_concurrent The maximum number of calls in flight at once.
+     @return One future per call, in the order of `calls`.
+     */
+    [[nodiscard]] std::vector<std::future<std::optional<bson::Bson>>>
+    call_functions(const std::vector<std::pair<std::string, realm::bson::BsonArray>>& calls,
+                   size_t max_concurrent = 8) const;
+
+    /**
+     Calls the Atlas App Services function with the provided name and arguments, exchanging
+     the arguments and the result as Extended JSON strings.
+
+     The result is handed over as the response body as received, without being parsed into a
+     `Bson` value, which suits large results that are forwarded or parsed incrementally.
+
+     @param name The name of the Atlas App Services function to be called.
+     @param arguments_ejson The arguments as an Extended JSON array, e.g. `[1, "two"]`.
+     @param callback The completion handler to call when the function call is complete. The
+     result pointer is only valid for the duration of the call, and is null on error.
+     This handler is executed on the thread that completes the request: the calling thread
+     with the default transport, or the transport's I/O thread with `CurlMultiTransport`,
+     where it must not block.
+     */
+    void call_function(const std::string& name, std::string_view arguments_ejson,
+                       std::function<void(const std::string*, std::optional<app_error>)> callback) const;
+
     /**
      Refresh a user's custom data. This will, in effect, refresh the user's auth session.
      */
@@ -211,6 +258,19 @@ public:
         std::optional<std::string> path;
         std::optional<std::map<std::string, std::string>> custom_http_headers;
         std::optional<std::array<char, 64>> metadata_encryption_key;
+        // Share one sync connection per server between the sessions of all realms opened by
+        // this app, instead of opening a connection per session.
+        bool multiplex_sessions = false;
+        // How long to wait for a sync connection to be established. Uses the sync client's
+        // default if unset.
+        std::optional<std::chrono::milliseconds> sync_connect_timeout;
+        // How long to keep a multiplexed connection open after its last session ends. Uses the
+        // sync client's default if unset.
+        std::optional<std::chrono::milliseconds> sync_connection_linger_time;
+        // Send app requests with `CurlMultiTransport`, which keeps any number of them in flight
+        // on one I/O thread, instead of blocking the calling thread for each request. Completion
+        // handlers then run on that I/O thread. Ignored when built without curl.
+        bool async_transport = false;
     };
 
     [[deprecated("Use App(const configuration&) instead.")]]
@@ -0,0 +1,148 @@
+#include <cpprealm/async_logger.hpp>
+
+#include <realm/util/assert.hpp>
+
+namespace realm {
+    namespace {
+        // The flusher thread of the logger it runs for, so the sink logging through the same
+        // logger never blocks on a full buffer.
+        thread_local const async_logger* t_flusher = nullptr;
+
+        size_t round_up_to_power_of_two(size_t n) {
+            size_t p = 2;
+            while (p < n) {
+                p <<= 1;
+            }
+            return p;
+        }
+    }
+
+    async_logger::async_logger(std::shared_ptr<logger> sink, size_t capacity, overflow_policy policy)
+        : m_sink(std::move(sink)), m_policy(policy) {
+        capacity = round_up_to_power_of_two(capacity);
+        m_slots = std::make_unique<slot[]>(capacity);
+        m_mask = capacity - 1;
+        for (size_t i = 0; i < capacity; i++) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_thread = std::thread([this] {
+            run();
+        });
+    }
+
+    async_logger::~async_logger() {
+        m_stopped.store(true, std::memory_order_seq_cst);
+        {
+            std::lock_guard lock(m_mutex);
+            m_cv.notify_one();
+        }
+        m_thread.join();
+    }
+
+    void async_logger::log(const record& r) {
+        enqueue(r.level, [&](slot& s) {
+            s.category = r.category;
+            s.message = r.message;
+            s.thread_id = r.thread_id;
+            s.timestamp = r.timestamp;
+        });
+    }
+
+    void async_logger::do_log(level l, const std::string& message) {
+        enqueue(l, [&](slot& s) {
+            s.message = message;
+        });
+    }
+
+    async_logger::slot* async_logger::claim(size_t& pos) {
+        pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& s = m_slots[pos & m_mask];
+            auto seq = s.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &s;
+                }
+            } else if (diff < 0) {
+                // The slot still holds a message from the previous lap: the buffer is full.
+                if (m_policy == overflow_policy::drop || t_flusher == this) {
+                    return nullptr;
+                }
+                wake();
+                std::this_thread::yield();
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            } else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void async_logger::wake() {
+        if (m_sleeping.load(std::memory_order_seq_cst)) {
+            std::lock_guard lock(m_mutex);
+            m_cv.notify_one();
+        }
+    }
+
+    bool async_logger::has_pending() const {
+        auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        return m_slots[pos & m_mask].sequence.load(std::memory_order_seq_cst) == pos + 1;
+    }
+
+    size_t async_logger::drain() {
+        size_t count = 0;
+        auto pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& s = m_slots[pos & m_mask];
+            if (s.sequence.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            if (s.format) {
+                s.message = s.format();
+                s.format = nullptr;
+            }
+            m_sink->log({s.lvl, s.category, s.message, s.thread_id, s.timestamp});
+            // Keep the string's capacity for the next message in this slot.
+            s.message.clear();
+            s.sequence.store(pos + m_mask + 1, std::memory_order_release);
+            m_dequeue_pos.store(++pos, std::memory_order_release);
+            count++;
+        }
+        return count;
+    }
+
+    void async_logger::run() {
+        t_flusher = this;
+        while (true) {
+            if (drain() > 0) {
+                continue;
+            }
+            if (m_stopped.load(std::memory_order_seq_cst)) {
+                drain();
+                return;
+            }
+            std::unique_lock lock(m_mutex);
+            m_sleeping.store(true, std::memory_order_seq_cst);
+            // The timeout bounds the latency of a wake-up lost to a producer still
+            // publishing its slot while this thread decided to sleep.
+            if (!has_pending() && !m_stopped.load(std::memory_order_seq_cst)) {
+                m_cv.wait_for(lock, std::chrono::milliseconds(50));
+            }
+            m_sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void async_logger::flush() {
+        // The flusher would wait for itself.
+        REALM_ASSERT_RELEASE(t_flusher != this);
+        auto target = m_enqueue_pos.load(std::memory_order_acquire);
+        while (m_dequeue_pos.load(std::memory_order_acquire) < target) {
+            {
+                std::lock_guard lock(m_mutex);
+                m_cv.notify_one();
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
@@ -0,0 +1,160 @@
+#ifndef CPP_REALM_ASYNC_LOGGER_HPP
+#define CPP_REALM_ASYNC_LOGGER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <cpprealm/logger.hpp>
+
+#include <realm/util/functional.hpp>
+#include <realm/util/to_string.hpp>
+
+namespace realm {
+
+    // A logger which hands messages to a background thread and returns immediately, so slow
+    // sinks (files, consoles, network) do not hold up the sync client or the caller.
+    //
+    // Messages go through a bounded, lock-free multi-producer ring buffer and are delivered to
+    // `sink` in order from a single flusher thread. When the buffer is full, the message is
+    // either dropped and counted in `dropped()` (`overflow_policy::drop`, the default), or the
+    // caller waits for space (`overflow_policy::block`). Messages logged by the sink itself are
+    // always dropped when the buffer is full, as blocking there could never make progress.
+    //
+    //     auto logger = std::make_shared<async_logger>(std::make_shared<my_file_logger>());
+    //     logger->set_level_threshold(logger::level::debug);
+    //     set_default_logger(logger);
+    //
+    // Messages logged with `log(level, fmt, args...)` are formatted on the flusher thread:
+    // a message below the threshold or dropped because the buffer is full costs a relaxed load
+    // or a failed slot reservation, and is never formatted.
+    struct async_logger : public logger {
+        enum class overflow_policy {
+            drop,
+            block
+        };
+
+        explicit async_logger(std::shared_ptr<logger> sink, size_t capacity = 8192,
+                              overflow_policy policy = overflow_policy::drop);
+        ~async_logger() override;
+        async_logger(const async_logger&) = delete;
+        async_logger& operator=(const async_logger&) = delete;
+
+        // Messages less severe than `l` are discarded on the calling thread. Defaults to `info`.
+        void set_level_threshold(level l) noexcept {
+            m_threshold.store(l, std::memory_order_relaxed);
+        }
+        [[nodiscard]] level level_threshold() const noexcept {
+            return m_threshold.load(std::memory_order_relaxed);
+        }
+        [[nodiscard]] bool would_log(level l) const noexcept {
+            return l >= m_threshold.load(std::memory_order_relaxed) && l != level::off;
+        }
+
+        // Queues an already formatted message; used for messages from the sync client and
+        // the database, which format them before they reach a logger. The category, thread
+        // and time of the record are passed on to the sink unchanged.
+        void log(const record& r) override;
+        // Queues a message under `log_category::sdk`.
+        void do_log(level l, const std::string& message) override;
+
+        // Queues a message to be formatted with `util::format` on the flusher thread. `args`
+        // are copied, with C strings and string views copied into a `std::string`, so they do
+        // not need to outlive the call. `fmt` must be a string literal.
+        template <typename... Args>
+        void log(level l, const char* fmt, Args&&... args) {
+            enqueue(l, [&](slot& s) {
+                s.format = [fmt, args = std::make_tuple(capture(std::forward<Args>(args))...)]() {
+                    return std::apply([fmt](const auto&... a) {
+                        return util::format(fmt, a...);
+                    }, args);
+                };
+            });
+        }
+
+        // Blocks until every message queued before the call has been passed to the sink.
+        // Must not be called from the sink.
+        void flush();
+
+        // The number of messages dropped because the buffer was full.
+        [[nodiscard]] uint64_t dropped() const noexcept {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        // Copies an argument for deferred formatting, taking ownership of borrowed strings.
+        template <typename T>
+        static auto capture(T&& v) {
+            using value_type = std::decay_t<T>;
+            if constexpr (std::is_same_v<value_type, const char*> || std::is_same_v<value_type, char*>) {
+                return v ? std::string(v) : std::string();
+            } else if constexpr (std::is_same_v<value_type, std::string_view>) {
+                return std::string(v);
+            } else {
+                return value_type(std::forward<T>(v));
+            }
+        }
+
+        struct slot {
+            std::atomic<size_t> sequence;
+            level lvl = level::info;
+            std::string category;
+            std::string message;
+            util::UniqueFunction<std::string()> format;
+            std::thread::id thread_id;
+            std::chrono::system_clock::time_point timestamp;
+        };
+
+        template <typename Fill>
+        void enqueue(level l, Fill&& fill) {
+            if (!would_log(l)) {
+                return;
+            }
+            size_t pos;
+            slot* s = claim(pos);
+            if (!s) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            s->lvl = l;
+            s->category = log_category::sdk;
+            s->thread_id = std::this_thread::get_id();
+            s->timestamp = std::chrono::system_clock::now();
+            fill(*s);
+            // Publishing must be ordered before the check of m_sleeping in wake().
+            s->sequence.store(pos + 1, std::memory_order_seq_cst);
+            wake();
+        }
+
+        slot* claim(size_t& pos);
+        void wake();
+        bool has_pending() const;
+        size_t drain();
+        void run();
+
+        std::shared_ptr<logger> m_sink;
+        overflow_policy m_policy;
+        std::atomic<level> m_threshold = level::info;
+        std::unique_ptr<slot[]> m_slots;
+        size_t m_mask;
+        alignas(64) std::atomic<size_t> m_enqueue_pos = 0;
+        alignas(64) std::atomic<size_t> m_dequeue_pos = 0;
+        std::atomic<uint64_t> m_dropped = 0;
+        std::atomic<bool> m_sleeping = false;
+        std::atomic<bool> m_stopped = false;
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::thread m_thread;
+    };
+}
+
+#endif //CPP_REALM_ASYNC_LOGGER_HPP
@@ -8,14 +8,18 @@
 
 #include <cpprealm/schema.hpp>
 
+#include <cpprealm/instrumentation.hpp>
 #include <cpprealm/internal/bridge/sync_session.hpp>
 #include <cpprealm/scheduler.hpp>
 #include <cpprealm/thread_safe_reference.hpp>
+#include <cpprealm/tracing.hpp>
 
 #include <cpprealm/experimental/macros.hpp>
 #include <cpprealm/experimental/results.hpp>
 #include <cpprealm/experimental/types.hpp>
 
+#include <algorithm>
+#include <array>
 #include <filesystem>
 #include <optional>
 #include <string>
@@ -35,6 +39,7 @@ namespace realm {
 
     using sync_config = internal::bridge::realm::sync_config;
     using db_config = internal::bridge::realm::config;
+    using db_file_stats = internal::bridge::realm::file_stats;
     using sync_session = internal::bridge::sync_session;
 
     struct sync_subscription_set;
@@ -57,6 +62,7 @@ namespace realm::experimental {
 
         template <typename Fn>
         std::invoke_result_t<Fn> write(Fn&& fn) const {
+            CPPREALM_TRACE_SCOPE("db", "db::write");
             begin_write();
             if constexpr (!std::is_void_v<std::invoke_result_t<Fn>>) {
                 auto val = fn();
@@ -85,6 +91,7 @@ namespace realm::experimental {
                         m_obj, m_obj.get_table().get_column_key(p.name), m_realm, v.*(std::decay_t<decltype(p)>::ptr)
                 ), ...);
             }, managed<T>::schema.ps);
+            internal::record_objects_created(m_realm, 1);
             auto m = managed<T>(std::move(m_obj), m_realm);
             std::apply([&m](auto && ...ptr) {
                 std::apply([&](auto&& ...name) {
@@ -117,6 +124,62 @@ namespace realm::experimental {
                     ), ...);
                 }, managed<T>::schema.ps);
             }
+            internal::record_objects_created(m_realm, v.size());
+        }
+
+
+        /// Writes asymmetric objects for upload, `batch_size` objects per write transaction.
+        ///
+        /// Unlike `add`, no managed accessor is created per object and column keys are looked
+        /// up once per call, which makes this the fast path for high-volume producers such as
+        /// telemetry. Asymmetric objects cannot be read back, so nothing is returned.
+        ///
+        /// When called inside `write`, all objects are added to the open write transaction and
+        /// `batch_size` is ignored.
+        template <typename T>
+        void ingest(const T* objects, size_t count, size_t batch_size = 1000) {
+            static_assert(sizeof(managed<T>), "Must declare schema for T");
+            static_assert(managed<T>::object_type == BetaObjectType::Asymmetric,
+                          "ingest is only available for objects declared with REALM_ASYMMETRIC_SCHEMA");
+            auto table = m_realm.table_for_object_type(managed<T>::schema.name);
+            auto col_keys = std::apply([&table](auto && ...p) {
+                return std::array<internal::bridge::col_key, sizeof...(p)>{table.get_column_key(p.name)...};
+            }, managed<T>::schema.ps);
+            auto add_range = [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    auto& v = objects[i];
+                    internal::bridge::obj m_obj;
+                    if constexpr (managed<T>::schema.HasPrimaryKeyProperty) {
+                        auto pk = v.*(managed<T>::schema.primary_key().ptr);
+                        m_obj = table.create_object_with_primary_key(realm::internal::bridge::mixed(serialize(pk.value)));
+                    } else {
+                        m_obj = table.create_object();
+                    }
+                    std::apply([&m_obj, &v, &col_keys, this](auto && ...p) {
+                        size_t col = 0;
+                        (accessor<typename std::decay_t<decltype(p)>::Result>::set(
+                                m_obj, col_keys[col++], m_realm, v.*(std::decay_t<decltype(p)>::ptr)
+                        ), ...);
+                    }, managed<T>::schema.ps);
+                }
+                internal::record_objects_created(m_realm, end - begin);
+            };
+            if (m_realm.is_in_transaction()) {
+                add_range(0, count);
+                return;
+            }
+            batch_size = std::max<size_t>(batch_size, 1);
+            for (size_t begin = 0; begin < count; begin += batch_size) {
+                auto end = std::min(count, begin + batch_size);
+                write([&] {
+                    add_range(begin, end);
+                });
+            }
+        }
+
+        template <typename T>
+        void ingest(const std::vector<T>& objects, size_t batch_size = 1000) {
+            ingest(objects.data(), objects.size(), batch_size);
         }
 
     private:
@@ -146,6 +209,39 @@ namespace realm::experimental {
             return m_realm.refresh();
         }
 
+        /// Returns a read-only snapshot of the current version which may be used from any thread,
+        /// e.g. from a `thread_pool_executor` worker.
+        [[nodiscard]] db freeze() const
+        {
+            return db(m_realm.freeze());
+        }
+
+        [[nodiscard]] bool is_frozen() const
+        {
+            return m_realm.is_frozen();
+        }
+
+        /// Returns the size of the file, its used and free space, the versions it retains and
+        /// the object count of each table, e.g. to find versions pinned by long-lived frozen
+        /// realms or background reads; this is cheap enough to poll on large files. With
+        /// `table_sizes` the estimated size of each table is read too, which takes time
+        /// proportional to the size of the data.
+        [[nodiscard]] db_file_stats file_stats(bool table_sizes = false) const
+        {
+            return m_realm.get_file_stats(table_sizes);
+        }
+
+        /// Returns the operation metrics of this realm's file, enabling their collection on
+        /// first use: transactions, commit latency and size, objects created, query executions
+        /// and latency, refreshes and pinned versions. Metrics are shared by every `db` opened
+        /// on the same path and can be exported with `realm_metrics::render_prometheus()`.
+        [[nodiscard]] std::shared_ptr<realm_metrics> metrics() const
+        {
+            auto metrics = realm_metrics::enable(m_realm.path());
+            metrics->active_versions.store(m_realm.get_number_of_versions(), std::memory_order_relaxed);
+            return metrics;
+        }
+
         ::realm::sync_subscription_set subscriptions();
 
         /**
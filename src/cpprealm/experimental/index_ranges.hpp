@@ -0,0 +1,157 @@
+#ifndef CPPREALM_EXPERIMENTAL_INDEX_RANGES_HPP
+#define CPPREALM_EXPERIMENTAL_INDEX_RANGES_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <cpprealm/internal/bridge/object.hpp>
+
+namespace realm::experimental {
+
+    /// The indices reported by a change notification, stored as sorted, non-overlapping
+    /// `[first, second)` runs. Iterating yields the individual indices without materialising them,
+    /// so the cost of a change set scales with the number of runs rather than the number of rows.
+    class index_ranges {
+    public:
+        using range = std::pair<uint64_t, uint64_t>;
+
+        class iterator {
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = uint64_t;
+            using pointer = const uint64_t*;
+            using reference = uint64_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            iterator() = default;
+
+            uint64_t operator*() const noexcept {
+                return m_index;
+            }
+
+            iterator& operator++() noexcept {
+                if (++m_index == m_range->second && ++m_range != m_end) {
+                    m_index = m_range->first;
+                }
+                return *this;
+            }
+
+            iterator operator++(int) noexcept {
+                auto it = *this;
+                ++(*this);
+                return it;
+            }
+
+            bool operator==(const iterator& other) const noexcept {
+                return m_range == other.m_range && (m_range == m_end || m_index == other.m_index);
+            }
+
+            bool operator!=(const iterator& other) const noexcept {
+                return !(*this == other);
+            }
+
+        private:
+            iterator(const range* range, const range* end)
+                : m_range(range), m_end(end), m_index(range != end ? range->first : 0) {}
+
+            const range* m_range = nullptr;
+            const range* m_end = nullptr;
+            uint64_t m_index = 0;
+            friend class index_ranges;
+        };
+
+        index_ranges() = default;
+
+        explicit index_ranges(std::vector<range>&& ranges)
+            : m_ranges(std::move(ranges)) {
+            m_offsets.reserve(m_ranges.size());
+            for (auto& [first, second] : m_ranges) {
+                m_offsets.push_back(m_size);
+                m_size += second - first;
+            }
+        }
+
+        index_ranges(const internal::bridge::index_set& index_set) //NOLINT(google-explicit-constructor)
+            : index_ranges(to_ranges(index_set)) {}
+
+        /// The `[first, second)` runs making up this set, in ascending order.
+        [[nodiscard]] const std::vector<range>& ranges() const noexcept {
+            return m_ranges;
+        }
+
+        /// The number of indices in the set.
+        [[nodiscard]] size_t size() const noexcept {
+            return m_size;
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return m_size == 0;
+        }
+
+        /// The n-th smallest index, found in O(log ranges).
+        uint64_t operator[](size_t n) const {
+            auto it = std::upper_bound(m_offsets.begin(), m_offsets.end(), static_cast<uint64_t>(n));
+            auto i = static_cast<size_t>(std::distance(m_offsets.begin(), it)) - 1;
+            return m_ranges[i].first + (n - m_offsets[i]);
+        }
+
+        [[nodiscard]] iterator begin() const noexcept {
+            return iterator(m_ranges.data(), m_ranges.data() + m_ranges.size());
+        }
+
+        [[nodiscard]] iterator end() const noexcept {
+            auto end = m_ranges.data() + m_ranges.size();
+            return iterator(end, end);
+        }
+
+        /// Expands the set into one element per index.
+        operator std::vector<uint64_t>() const { //NOLINT(google-explicit-constructor)
+            std::vector<uint64_t> indices;
+            indices.reserve(m_size);
+            for (auto& [first, second] : m_ranges) {
+                for (auto i = first; i < second; i++) {
+                    indices.push_back(i);
+                }
+            }
+            return indices;
+        }
+
+        friend bool operator==(const index_ranges& lhs, const index_ranges& rhs) noexcept {
+            return lhs.m_ranges == rhs.m_ranges;
+        }
+        friend bool operator!=(const index_ranges& lhs, const index_ranges& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+        friend bool operator==(const index_ranges& lhs, const std::vector<uint64_t>& rhs) {
+            return lhs.size() == rhs.size() && std::equal(rhs.begin(), rhs.end(), lhs.begin());
+        }
+        friend bool operator==(const std::vector<uint64_t>& lhs, const index_ranges& rhs) {
+            return rhs == lhs;
+        }
+        friend bool operator!=(const index_ranges& lhs, const std::vector<uint64_t>& rhs) {
+            return !(lhs == rhs);
+        }
+        friend bool operator!=(const std::vector<uint64_t>& lhs, const index_ranges& rhs) {
+            return !(rhs == lhs);
+        }
+
+    private:
+        static std::vector<range> to_ranges(const internal::bridge::index_set& index_set) {
+            std::vector<range> ranges;
+            for (auto& [first, second] : index_set.ranges()) {
+                ranges.emplace_back(first, second);
+            }
+            return ranges;
+        }
+
+        std::vector<range> m_ranges;
+        // m_offsets[i] is the number of indices contained in the runs before m_ranges[i].
+        std::vector<uint64_t> m_offsets;
+        size_t m_size = 0;
+    };
+}
+
+#endif //CPPREALM_EXPERIMENTAL_INDEX_RANGES_HPP
@@ -444,6 +444,15 @@ rbool managed<std::optional<type>>::operator op(const std::optional<type>& rhs)
             return m_object->add_notification_callback( \
             std::make_shared<realm::experimental::ObjectChangeCallbackWrapper<managed>>(wrapper));                               \
         }                      \
+        auto observe(std::function<void(realm::experimental::object_change<managed>&&)>&& fn, \
+                     const std::vector<std::string>& key_paths) { \
+            auto m_object = std::make_shared<internal::bridge::object>(m_realm, m_obj); \
+            auto resolved = internal::bridge::make_key_path_array(m_obj.get_table(), key_paths); \
+            auto wrapper = realm::experimental::ObjectChangeCallbackWrapper<managed>{ \
+            std::move(fn), this, m_object, key_paths}; \
+            return m_object->add_notification_callback( \
+            std::make_shared<realm::experimental::ObjectChangeCallbackWrapper<managed>>(wrapper), resolved); \
+        } \
         bool operator ==(const managed<cls>& other) const {                                                               \
             auto& a = m_obj; \
             auto& b = other.m_obj; \
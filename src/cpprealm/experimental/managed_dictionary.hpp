@@ -11,9 +11,9 @@ namespace realm::experimental {
     template<typename mapped_type>
     struct box_base {
         box_base(internal::bridge::core_dictionary &&backing_map,
-                 const std::string &key,
+                 std::string key,
                  const internal::bridge::realm &r)
-            : m_backing_map(std::move(backing_map)), m_key(key), m_realm(r) {}
+            : m_backing_map(std::move(backing_map)), m_realm(r), m_key(std::move(key)) {}
 
         box_base &operator=(const mapped_type &o) {
             m_backing_map.insert(m_key, internal::bridge::mixed(std::move(o)));
@@ -524,10 +524,22 @@ namespace realm::experimental {
 
             std::pair<std::string, T> operator*() noexcept
             {
-                auto pair = m_parent->m_obj->get_dictionary(m_parent->m_key).get_pair(m_i);
+                auto pair = dictionary().get_pair(m_i);
                 return { pair.first, deserialize<T>(pair.second) };
             }
 
+            /// A view of the current key which does not copy it out of the Realm.
+            /// The view is only valid until the next write or refresh.
+            std::string_view key() const
+            {
+                return dictionary().get_key(m_i);
+            }
+
+            T value() const
+            {
+                return deserialize<T>(dictionary().get_value(m_i));
+            }
+
             iterator& operator++()
             {
                 this->m_i++;
@@ -547,8 +559,25 @@ namespace realm::experimental {
                 : m_i(i), m_parent(parent)
             {
             }
+
+            iterator(size_t i, const managed<std::map<std::string, T>>* parent, internal::bridge::core_dictionary&& dictionary)
+                : m_i(i), m_parent(parent), m_dictionary(std::move(dictionary))
+            {
+            }
+
+            // Looked up on first access, so that iterators which are only compared, such as
+            // `end()`, stay cheap.
+            const internal::bridge::core_dictionary& dictionary() const
+            {
+                if (!m_dictionary) {
+                    m_dictionary.emplace(m_parent->m_obj->get_dictionary(m_parent->m_key));
+                }
+                return *m_dictionary;
+            }
+
             size_t m_i;
             const managed<std::map<std::string, T>>* m_parent;
+            mutable std::optional<internal::bridge::core_dictionary> m_dictionary;
         };
 
         size_t size() const
@@ -566,26 +595,56 @@ namespace realm::experimental {
             return iterator(size(), this);
         }
 
-        iterator find(const std::string& key) {
+        iterator find(std::string_view key) {
             // Dictionary's `find` searches for the index of the value and not the key.
             auto d = m_obj->get_dictionary(m_key);
             auto i = d.find_any_key(key);
             if (i == size_t(-1)) {
-                return iterator(size(), this);
+                return iterator(d.size(), this);
             } else {
-                return iterator(i, this);
+                return iterator(i, this, std::move(d));
             }
         }
 
-        box<std::conditional_t<std::is_pointer_v<T>, managed<T>, T>>  operator[](const std::string &a) {
+        bool contains(std::string_view key) const {
+            return m_obj->get_dictionary(m_key).contains(key);
+        }
+
+        box<std::conditional_t<std::is_pointer_v<T>, managed<T>, T>>  operator[](std::string_view a) {
             if constexpr (std::is_pointer_v<T>) {
-                return box<managed<T>>(m_obj->get_dictionary(m_key), a, *m_realm);
+                return box<managed<T>>(m_obj->get_dictionary(m_key), std::string(a), *m_realm);
             } else {
-                return box<T>(m_obj->get_dictionary(m_key), a, *m_realm);
+                return box<T>(m_obj->get_dictionary(m_key), std::string(a), *m_realm);
+            }
+        }
+
+        /// Inserts or replaces every key/value pair in [first, last) with a single
+        /// call into the storage engine. Keys are copied, so the iterator may yield temporaries.
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last) {
+            static_assert(internal::type_info::is_primitive<T>::value,
+                          "Bulk insert is only supported for maps of primitive values.");
+            std::vector<std::pair<std::string, internal::bridge::mixed>> values;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+                values.reserve(static_cast<size_t>(std::distance(first, last)));
+            }
+            for (; first != last; ++first) {
+                const auto& [k, v] = *first;
+                if constexpr (internal::type_info::MixedPersistableConcept<T>::value) {
+                    values.emplace_back(std::string(k), serialize(v, *m_realm));
+                } else {
+                    values.emplace_back(std::string(k), internal::bridge::mixed(serialize(v)));
+                }
             }
+            m_obj->get_dictionary(m_key).insert(values);
+        }
+
+        template <typename Range>
+        void insert(const Range& values) {
+            insert(std::begin(values), std::end(values));
         }
 
-        void erase(const std::string& key) {
+        void erase(std::string_view key) {
             m_obj->get_dictionary(m_key).erase(key);
         }
 
@@ -14,6 +14,10 @@ namespace realm::experimental {
 
         class iterator {
         public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = T;
             using iterator_category = std::input_iterator_tag;
 
             bool operator!=(const iterator& other) const
@@ -46,43 +50,45 @@ namespace realm::experimental {
             template<typename, typename>
             friend struct managed;
 
-            iterator(size_t i, managed<std::vector<T>>* parent)
+            iterator(size_t i, const managed<std::vector<T>>* parent)
                 : m_i(i), m_parent(parent)
             {
             }
             size_t m_i;
-            managed<std::vector<T>>* m_parent;
+            const managed<std::vector<T>>* m_parent;
         };
-        iterator begin()
+        iterator begin() const
         {
             return iterator(0, this);
         }
 
-        iterator end()
+        iterator end() const
         {
             return iterator(size(), this);
         }
         [[nodiscard]] std::vector<T> detach() const {
+            std::vector<T> ret;
+            detach_into(ret);
+            return ret;
+        }
+
+        /// Detaches the list into `out`, reusing its existing capacity.
+        void detach_into(std::vector<T>& out) const {
             auto list = realm::internal::bridge::list(*m_realm, *m_obj, m_key);
             using U = typename internal::type_info::type_info<T>::internal_type;
 
             size_t count = list.size();
-            if (count == 0)
-                return std::vector<T>();
-
-            auto ret = std::vector<T>();
-            ret.reserve(count);
+            out.clear();
+            out.reserve(count);
             for(size_t i = 0; i < count; i++) {
                 if constexpr (internal::type_info::MixedPersistableConcept<T>::value) {
-                    ret.push_back(deserialize<T>(realm::internal::bridge::get<U>(list, i)));
+                    out.push_back(deserialize<T>(realm::internal::bridge::get<U>(list, i)));
                 } else if constexpr (std::is_enum_v<T>) {
-                    ret.push_back(deserialize<T>(realm::internal::bridge::get<U>(list, i)));
+                    out.push_back(static_cast<T>(deserialize<T>(realm::internal::bridge::get<U>(list, i))));
                 } else {
-                    ret.push_back(deserialize(realm::internal::bridge::get<U>(list, i)));
+                    out.push_back(deserialize(realm::internal::bridge::get<U>(list, i)));
                 }
             }
-
-            return ret;
         }
 
         realm::notification_token observe(std::function<void(realm::experimental::collection_change)>&& fn) {
@@ -123,7 +129,43 @@ namespace realm::experimental {
             auto list = internal::bridge::list(*m_realm, *m_obj, m_key);
             list.add(serialize(value));
         }
-        size_t size()
+        /// Appends the values in [first, last) with a single call into the storage engine.
+        template <typename InputIt>
+        void append(InputIt first, InputIt last)
+        {
+            auto list = internal::bridge::list(*m_realm, *m_obj, m_key);
+            list.insert(list.size(), serialize_range(first, last));
+        }
+        /// Inserts the values of `values` before position `pos`.
+        template <typename Range>
+        void insert(size_t pos, const Range& values)
+        {
+            internal::bridge::list(*m_realm, *m_obj, m_key).insert(pos, serialize_range(std::begin(values), std::end(values)));
+        }
+        void insert(size_t pos, std::initializer_list<T> values)
+        {
+            internal::bridge::list(*m_realm, *m_obj, m_key).insert(pos, serialize_range(values.begin(), values.end()));
+        }
+        /// Replaces the contents of the list with `values`.
+        template <typename Range>
+        void assign(const Range& values)
+        {
+            internal::bridge::list(*m_realm, *m_obj, m_key).assign(serialize_range(std::begin(values), std::end(values)));
+        }
+        void assign(std::initializer_list<T> values)
+        {
+            internal::bridge::list(*m_realm, *m_obj, m_key).assign(serialize_range(values.begin(), values.end()));
+        }
+        /// Removes the elements in the range [first, last).
+        void erase(size_t first, size_t last)
+        {
+            internal::bridge::list(*m_realm, *m_obj, m_key).remove(first, last);
+        }
+        void erase(const iterator& first, const iterator& last)
+        {
+            erase(first.m_i, last.m_i);
+        }
+        size_t size() const
         {
             return internal::bridge::list(*m_realm, *m_obj, m_key).size();
         }
@@ -137,6 +179,18 @@ namespace realm::experimental {
         void set(size_t pos, const T& a) {
             internal::bridge::list(*m_realm, *m_obj, m_key).set(pos, a);
         }
+    private:
+        template <typename InputIt>
+        static std::vector<typename internal::type_info::type_info<T>::internal_type> serialize_range(InputIt first, InputIt last) {
+            std::vector<typename internal::type_info::type_info<T>::internal_type> values;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+                values.reserve(static_cast<size_t>(std::distance(first, last)));
+            }
+            for (; first != last; ++first) {
+                values.push_back(serialize(static_cast<const T&>(*first)));
+            }
+            return values;
+        }
     };
 
     template<typename T>
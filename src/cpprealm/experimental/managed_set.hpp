@@ -124,6 +124,53 @@ namespace realm::experimental {
                 return iterator(size(), this);
             return iterator(idx, this);
         }
+        /// Set algebra below runs inside the storage engine; neither side is
+        /// materialized. The in-place operations return the resulting size.
+        size_t intersect(const managed<std::set<T>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_intersection(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+            return set.size();
+        }
+        size_t union_with(const managed<std::set<T>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_union(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+            return set.size();
+        }
+        size_t difference(const managed<std::set<T>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_difference(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+            return set.size();
+        }
+        size_t symmetric_difference(const managed<std::set<T>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_symmetric_difference(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+            return set.size();
+        }
+        [[nodiscard]] bool is_subset_of(const managed<std::set<T>>& other) const
+        {
+            return internal::bridge::set(*m_realm, *m_obj, m_key)
+                    .is_subset_of(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+        [[nodiscard]] bool is_superset_of(const managed<std::set<T>>& other) const
+        {
+            return internal::bridge::set(*m_realm, *m_obj, m_key)
+                    .is_superset_of(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+        [[nodiscard]] bool intersects(const managed<std::set<T>>& other) const
+        {
+            return internal::bridge::set(*m_realm, *m_obj, m_key)
+                    .intersects(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+        [[nodiscard]] bool set_equals(const managed<std::set<T>>& other) const
+        {
+            return internal::bridge::set(*m_realm, *m_obj, m_key)
+                    .set_equals(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
         void clear() {
             internal::bridge::set(*m_realm, *m_obj, m_key).remove_all();
         }
@@ -330,6 +377,53 @@ namespace realm::experimental {
                 return iterator(size(), this);
             return iterator(idx, this);
         }
+        /// Set algebra below runs inside the storage engine; neither side is
+        /// materialized. The in-place operations return the resulting size.
+        size_t intersect(const managed<std::set<T*>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_intersection(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+            return set.size();
+        }
+        size_t union_with(const managed<std::set<T*>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_union(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+            return set.size();
+        }
+        size_t difference(const managed<std::set<T*>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_difference(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+            return set.size();
+        }
+        size_t symmetric_difference(const managed<std::set<T*>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_symmetric_difference(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+            return set.size();
+        }
+        [[nodiscard]] bool is_subset_of(const managed<std::set<T*>>& other) const
+        {
+            return internal::bridge::set(*m_realm, *m_obj, m_key)
+                    .is_subset_of(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+        [[nodiscard]] bool is_superset_of(const managed<std::set<T*>>& other) const
+        {
+            return internal::bridge::set(*m_realm, *m_obj, m_key)
+                    .is_superset_of(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+        [[nodiscard]] bool intersects(const managed<std::set<T*>>& other) const
+        {
+            return internal::bridge::set(*m_realm, *m_obj, m_key)
+                    .intersects(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+        [[nodiscard]] bool set_equals(const managed<std::set<T*>>& other) const
+        {
+            return internal::bridge::set(*m_realm, *m_obj, m_key)
+                    .set_equals(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
         void clear() {
             internal::bridge::set(*m_realm, *m_obj, m_key).remove_all();
         }
@@ -1,6 +1,7 @@
 #ifndef CPPREALM_OBSERVATION_HPP
 #define CPPREALM_OBSERVATION_HPP
 
+#include <cpprealm/experimental/index_ranges.hpp>
 #include <cpprealm/experimental/macros.hpp>
 #include <cpprealm/internal/bridge/object.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
@@ -11,6 +12,7 @@
 #include <cpprealm/internal/bridge/thread_safe_reference.hpp>
 
 #include <realm/object-store/util/scheduler.hpp>
+#include <algorithm>
 #include <iostream>
 #include <variant>
 
@@ -67,13 +69,19 @@ namespace realm::experimental {
     struct ObjectChangeCallbackWrapper : internal::bridge::collection_change_callback {
         ObjectChangeCallbackWrapper(std::function<void(object_change < T > )> &&b,
                                     const T *obj,
-                                    std::shared_ptr<internal::bridge::object> internal_object)
+                                    std::shared_ptr<internal::bridge::object> internal_object,
+                                    const std::vector<std::string>& key_paths = {})
                 : block(std::move(b)), object(*obj), m_object(internal_object) {
             static_cast<void>(obj);
+            // Only the first component of each key path names a property on this object.
+            for (auto& key_path : key_paths) {
+                observed_properties.push_back(key_path.substr(0, key_path.find('.')));
+            }
         }
         std::function<void(object_change < T > )> block;
         const T object;
         std::shared_ptr<internal::bridge::object> m_object;
+        std::vector<std::string> observed_properties;
 
         std::optional<std::vector<std::string>> property_names = std::nullopt;
         std::optional<std::vector<typename decltype(T::schema)::variant_t>> old_values = std::nullopt;
@@ -97,6 +105,10 @@ namespace realm::experimental {
             auto table = m_object->get_obj().get_table();
 
             for (auto i = 0; i < std::tuple_size<decltype(T::schema.properties)>{}; i++) {
+                if (!observed_properties.empty() &&
+                    std::find(observed_properties.begin(), observed_properties.end(), T::schema.names[i]) == observed_properties.end()) {
+                    continue;
+                }
                 if (c.columns().count(table.get_column_key(T::schema.names[i]).value())) {
                     properties.push_back(T::schema.names[i]);
                 }
@@ -185,9 +197,9 @@ namespace realm::experimental {
     };
 
     struct collection_change {
-        std::vector<uint64_t> deletions;
-        std::vector<uint64_t> insertions;
-        std::vector<uint64_t> modifications;
+        index_ranges deletions;
+        index_ranges insertions;
+        index_ranges modifications;
 
         // This flag indicates whether the underlying object which is the source of this
         // collection was deleted. This applies to lists, dictionaries and sets.
@@ -222,21 +234,12 @@ namespace realm::experimental {
 
             }
             else if (!changes.collection_root_was_deleted() || !changes.deletions().empty()) {
-                handler({to_vector(changes.deletions()),
-                        to_vector(changes.insertions()),
-                        to_vector(changes.modifications()),
+                handler({changes.deletions(),
+                        changes.insertions(),
+                        changes.modifications(),
                 });
             }
         }
-
-    private:
-        std::vector<uint64_t> to_vector(const internal::bridge::index_set& index_set) {
-            auto vector = std::vector<uint64_t>();
-            for (auto index : index_set.as_indexes()) {
-                vector.push_back(index);
-            }
-            return vector;
-        };
     };
 
 #if __cpp_coroutines
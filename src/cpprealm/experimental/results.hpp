@@ -5,9 +5,12 @@
 #include <cpprealm/internal/bridge/query.hpp>
 #include <cpprealm/internal/bridge/table.hpp>
 #include <cpprealm/internal/bridge/results.hpp>
+#include <cpprealm/experimental/index_ranges.hpp>
 #include <cpprealm/experimental/macros.hpp>
 #include <cpprealm/schema.hpp>
 
+#include <chrono>
+
 namespace realm {
     class rbool;
     struct mutable_sync_subscription_set;
@@ -18,6 +21,15 @@ namespace realm::experimental {
     template<typename>
     struct results;
 
+    /// Limits how often a results observer is called. Changes from the commits in between are
+    /// merged into a single `results_change`. Leaving both fields at zero delivers every commit.
+    struct notification_options {
+        /// Minimum time between two calls of the handler.
+        std::chrono::milliseconds min_interval{0};
+        /// Deliver as soon as this many commits are pending, even if `min_interval` has not passed.
+        size_t max_pending_commits = 0;
+    };
+
     template<typename T>
     struct query : public T {
     private:
@@ -54,9 +66,9 @@ namespace realm::experimental {
     struct results {
         struct results_change {
             results<T> *collection;
-            std::vector<uint64_t> deletions;
-            std::vector<uint64_t> insertions;
-            std::vector<uint64_t> modifications;
+            index_ranges deletions;
+            index_ranges insertions;
+            index_ranges modifications;
 
             // This flag indicates whether the underlying object which is the source of this
             // collection was deleted. This applies to lists, dictionaries and sets.
@@ -171,21 +183,12 @@ namespace realm::experimental {
                 } else if (!changes.collection_root_was_deleted() || !changes.deletions().empty()) {
                     handler({
                             &collection,
-                            to_vector(changes.deletions()),
-                            to_vector(changes.insertions()),
-                            to_vector(changes.modifications()),
+                            changes.deletions(),
+                            changes.insertions(),
+                            changes.modifications(),
                     });
                 }
             }
-
-        private:
-            std::vector<uint64_t> to_vector(const internal::bridge::index_set &index_set) {
-                auto vector = std::vector<uint64_t>();
-                for (auto index: index_set.as_indexes()) {
-                    vector.push_back(index);
-                }
-                return vector;
-            };
         };
 
         internal::bridge::notification_token observe(std::function<void(results_change)> &&handler) {
@@ -193,6 +196,31 @@ namespace realm::experimental {
                     std::make_shared<results_callback_wrapper>(std::move(handler), dynamic_cast<results<T> &>(*this)));
         }
 
+        /// Observes the results, but only reports changes to objects that touch one of `key_paths`,
+        /// e.g. `{"status", "owner.name"}`. Throws `std::invalid_argument` for unknown properties.
+        internal::bridge::notification_token observe(std::function<void(results_change)> &&handler,
+                                                     const std::vector<std::string>& key_paths) {
+            return m_parent.add_notification_callback(
+                    std::make_shared<results_callback_wrapper>(std::move(handler), dynamic_cast<results<T> &>(*this)),
+                    internal::bridge::make_key_path_array(m_parent.get_table(), key_paths));
+        }
+
+        /// Observes the results, coalescing changes according to `options`. Deferred changes are
+        /// delivered on the scheduler of the realm the results belong to.
+        internal::bridge::notification_token observe(std::function<void(results_change)> &&handler,
+                                                     const notification_options& options) {
+            return m_parent.add_notification_callback(make_coalescing_wrapper(std::move(handler), options));
+        }
+
+        /// Observes the results for changes to `key_paths` only, coalescing them according to `options`.
+        internal::bridge::notification_token observe(std::function<void(results_change)> &&handler,
+                                                     const std::vector<std::string>& key_paths,
+                                                     const notification_options& options) {
+            return m_parent.add_notification_callback(
+                    make_coalescing_wrapper(std::move(handler), options),
+                    internal::bridge::make_key_path_array(m_parent.get_table(), key_paths));
+        }
+
         explicit results(internal::bridge::results &&parent)
             : m_parent(parent) {
         }
@@ -206,6 +234,18 @@ namespace realm::experimental {
     protected:
         internal::bridge::results m_parent;
         template <auto> friend struct linking_objects;
+
+    private:
+        std::shared_ptr<internal::bridge::collection_change_callback>
+        make_coalescing_wrapper(std::function<void(results_change)> &&handler, const notification_options& options) {
+            std::shared_ptr<internal::bridge::collection_change_callback> wrapper =
+                    std::make_shared<results_callback_wrapper>(std::move(handler), dynamic_cast<results<T> &>(*this));
+            if (options.min_interval.count() > 0 || options.max_pending_commits > 0) {
+                wrapper = internal::bridge::make_coalescing_callback(std::move(wrapper), m_parent.get_realm(),
+                                                                     options.min_interval, options.max_pending_commits);
+            }
+            return wrapper;
+        }
     };
 
     template <auto ptr>
@@ -18,5 +18,9 @@
 #include <cpprealm/experimental/link.hpp>
 #include <cpprealm/experimental/observation.hpp>
 #include <cpprealm/experimental/db.hpp>
+#include <cpprealm/async_logger.hpp>
+#include <cpprealm/instrumentation.hpp>
+#include <cpprealm/thread_pool_executor.hpp>
+#include <cpprealm/tracing.hpp>
 
 #endif //CPPREALM_EXPERIMENTAL_SDK_HPP
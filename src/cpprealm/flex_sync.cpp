@@ -3,6 +3,8 @@
 #include <realm/object-store/shared_realm.hpp>
 #include <realm/sync/subscriptions.hpp>
 
+#include <map>
+
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
 #else
 #endif
@@ -187,6 +189,80 @@ namespace realm {
         return f;
     }
 
+    namespace {
+        std::string subscription_key(const sync::Subscription& sub) {
+            return sub.name ? *sub.name : sub.object_class_name + ": " + sub.query_string;
+        }
+
+        template <typename Set>
+        std::map<std::string, const sync::Subscription*> subscriptions_by_key(const Set& set) {
+            std::map<std::string, const sync::Subscription*> subs;
+            for (auto& sub : set) {
+                subs.emplace(subscription_key(sub), &sub);
+            }
+            return subs;
+        }
+    }
+
+    std::future<sync_subscription_diff> sync_subscription_set::reconcile(std::function<void(mutable_sync_subscription_set&)>&& fn) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto* set = reinterpret_cast<sync::SubscriptionSet *>(&m_subscription_set);
+#else
+        auto* set = m_subscription_set.get();
+#endif
+        auto mutable_copy = set->make_mutable_copy();
+        mutable_copy.clear();
+        auto mutable_set = mutable_sync_subscription_set(m_realm, mutable_copy);
+        fn(mutable_set);
+        auto desired_set = mutable_set.get_subscription_set();
+
+        sync_subscription_diff diff;
+        auto current = subscriptions_by_key(*set);
+        auto desired = subscriptions_by_key(desired_set);
+        for (auto& [key, sub] : current) {
+            auto it = desired.find(key);
+            if (it == desired.end()) {
+                diff.removed.push_back(key);
+            } else if (it->second->object_class_name != sub->object_class_name ||
+                       it->second->query_string != sub->query_string) {
+                diff.updated.push_back(key);
+            }
+        }
+        for (auto& [key, sub] : desired) {
+            if (!current.count(key)) {
+                diff.added.push_back(key);
+            }
+        }
+
+        std::promise<sync_subscription_diff> p;
+        std::future<sync_subscription_diff> f = p.get_future();
+        // Dropping the uncommitted mutable set discards its write.
+        if (diff.empty()) {
+            p.set_value(std::move(diff));
+            return f;
+        }
+
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        reinterpret_cast<sync::SubscriptionSet*>(&m_subscription_set)->~SubscriptionSet();
+        new (&m_subscription_set) sync::SubscriptionSet(std::move(desired_set).commit());
+#else
+        m_subscription_set = std::make_shared<sync::SubscriptionSet>(std::move(desired_set).commit());
+#endif
+
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto* subscription_set = reinterpret_cast<sync::SubscriptionSet *>(&m_subscription_set);
+#else
+        auto* subscription_set = m_subscription_set.get();
+#endif
+        subscription_set->get_state_change_notification(realm::sync::SubscriptionSet::State::Complete)
+                .get_async([p = std::move(p), diff = std::move(diff)](const realm::StatusWith<realm::sync::SubscriptionSet::State>& state) mutable noexcept {
+                    diff.complete = state == sync::SubscriptionSet::State::Complete;
+                    p.set_value(std::move(diff));
+                });
+
+        return f;
+    }
+
     sync_subscription_set::sync_subscription_set(internal::bridge::realm& realm)
             : m_realm(realm)
     {
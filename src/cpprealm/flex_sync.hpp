@@ -175,6 +175,22 @@ namespace realm {
         sync::MutableSubscriptionSet get_subscription_set();
     };
 
+    // The difference between two subscription sets, by subscription name. Unnamed
+    // subscriptions are reported as "<object class>: <query>".
+    struct sync_subscription_diff {
+        std::vector<std::string> added;
+        std::vector<std::string> removed;
+        // Subscriptions whose object class or query changed.
+        std::vector<std::string> updated;
+        // False if the server could not bootstrap the new set, in which case `update()` would
+        // have resolved with false.
+        bool complete = true;
+
+        [[nodiscard]] bool empty() const {
+            return added.empty() && removed.empty() && updated.empty();
+        }
+    };
+
     struct sync_subscription_set {
     public:
         sync_subscription_set() = delete;
@@ -193,6 +209,21 @@ namespace realm {
 
         std::future<bool> update(std::function<void(mutable_sync_subscription_set&)>&& fn);
 
+        // Makes the set match the subscriptions added by `fn`, which declares the complete
+        // desired set starting from an empty one:
+        //
+        //     realm.subscriptions().reconcile([](auto& subs) {
+        //         subs.add<Person>("adults", [](auto& p) { return p.age >= 18; });
+        //         subs.add<Dog>("dogs");
+        //     });
+        //
+        // A new version of the set is only committed, and the server only asked to
+        // bootstrap, if the declared set differs from the current one. The returned future
+        // resolves with the difference once the server has caught up with the new set, or
+        // immediately if nothing differed. Like `update()`, a failed update does not throw;
+        // it resolves with `complete` set to false.
+        std::future<sync_subscription_diff> reconcile(std::function<void(mutable_sync_subscription_set&)>&& fn);
+
         explicit sync_subscription_set(internal::bridge::realm& realm);
     private:
         template <typename ...Ts>
@@ -0,0 +1,378 @@
+#include <cpprealm/instrumentation.hpp>
+
+#include <cpprealm/internal/bridge/object.hpp>
+#include <cpprealm/internal/bridge/realm.hpp>
+
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/util/functional.hpp>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace realm {
+    namespace {
+        int64_t now_ns() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        struct metrics_registry {
+            std::mutex mutex;
+            std::map<std::string, std::shared_ptr<realm_metrics>> metrics;
+            // Lets the common case of no registered metrics skip the lock.
+            std::atomic<size_t> size = 0;
+            // Bumped on every change, invalidating the per-thread lookup caches.
+            std::atomic<uint64_t> generation = 1;
+        };
+
+        // The last lookup made on this thread; transactions and queries on the same realm
+        // find their metrics without taking the registry lock.
+        struct lookup_cache {
+            uint64_t generation = 0;
+            std::string path;
+            std::shared_ptr<realm_metrics> metrics;
+        };
+        thread_local lookup_cache t_lookup;
+
+        metrics_registry& registry() {
+            static metrics_registry r;
+            return r;
+        }
+
+        size_t bucket_for(uint64_t value) noexcept {
+            size_t bucket = 0;
+            while (value) {
+                value >>= 1;
+                bucket++;
+            }
+            return std::min(bucket, latency_histogram::bucket_count - 1);
+        }
+    }
+
+    uint64_t latency_histogram::snapshot::upper_bound(size_t i) noexcept {
+        return i + 1 >= bucket_count ? UINT64_MAX : (uint64_t(1) << i);
+    }
+
+    uint64_t latency_histogram::snapshot::percentile(double p) const noexcept {
+        if (count == 0) {
+            return 0;
+        }
+        auto target = static_cast<uint64_t>(static_cast<double>(count) * p / 100.0);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucket_count; i++) {
+            seen += buckets[i];
+            if (seen > target || seen == count) {
+                return std::min(upper_bound(i), max);
+            }
+        }
+        return max;
+    }
+
+    double latency_histogram::snapshot::mean() const noexcept {
+        return count ? static_cast<double>(sum) / static_cast<double>(count) : 0;
+    }
+
+    void latency_histogram::record(uint64_t value) noexcept {
+        m_buckets[bucket_for(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+        auto max = m_max.load(std::memory_order_relaxed);
+        while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+    }
+
+    latency_histogram::snapshot latency_histogram::get_snapshot() const noexcept {
+        snapshot s;
+        for (size_t i = 0; i < bucket_count; i++) {
+            s.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+        }
+        s.count = m_count.load(std::memory_order_relaxed);
+        s.sum = m_sum.load(std::memory_order_relaxed);
+        s.max = m_max.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    void latency_histogram::reset() noexcept {
+        for (auto& bucket : m_buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+    void realm_metrics::mark_commit(uint64_t version) {
+        std::lock_guard lock(m_commits_mutex);
+        // Bounds the map when nothing observes the realm.
+        if (m_commit_times.size() >= 64) {
+            m_commit_times.erase(m_commit_times.begin());
+        }
+        m_commit_times.emplace(version, now_ns());
+    }
+
+    void realm_metrics::mark_notify(uint64_t version) {
+        auto now = now_ns();
+        std::lock_guard lock(m_commits_mutex);
+        auto end = m_commit_times.upper_bound(version);
+        for (auto it = m_commit_times.begin(); it != end; ++it) {
+            commit_to_notify.record(static_cast<uint64_t>(std::max<int64_t>(now - it->second, 0)));
+        }
+        m_commit_times.erase(m_commit_times.begin(), end);
+    }
+
+    realm_metrics::snapshot realm_metrics::get_snapshot() const noexcept {
+        snapshot s;
+        s.enqueue_to_run = enqueue_to_run.get_snapshot();
+        s.queue_depth = queue_depth.get_snapshot();
+        s.run_duration = run_duration.get_snapshot();
+        s.handler_duration = handler_duration.get_snapshot();
+        s.commit_to_notify = commit_to_notify.get_snapshot();
+        s.write_transactions = write_transactions.load(std::memory_order_relaxed);
+        s.commits = commits.load(std::memory_order_relaxed);
+        s.commit_duration = commit_duration.get_snapshot();
+        s.commit_size = commit_size.get_snapshot();
+        s.objects_created = objects_created.load(std::memory_order_relaxed);
+        s.query_executions = query_executions.load(std::memory_order_relaxed);
+        s.query_duration = query_duration.get_snapshot();
+        s.refreshes = refreshes.load(std::memory_order_relaxed);
+        s.freezes = freezes.load(std::memory_order_relaxed);
+        s.active_versions = active_versions.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    std::string realm_metrics::to_string() const {
+        std::ostringstream ss;
+        auto print = [&ss](const char* name, const latency_histogram& h) {
+            auto s = h.get_snapshot();
+            ss << name << ": count=" << s.count << " mean=" << s.mean() << " p50=" << s.percentile(50)
+               << " p99=" << s.percentile(99) << " max=" << s.max << "\n";
+        };
+        print("enqueue_to_run_ns", enqueue_to_run);
+        print("queue_depth", queue_depth);
+        print("run_duration_ns", run_duration);
+        print("handler_duration_ns", handler_duration);
+        print("commit_to_notify_ns", commit_to_notify);
+        print("commit_duration_ns", commit_duration);
+        print("commit_size_bytes", commit_size);
+        print("query_duration_ns", query_duration);
+        ss << "write_transactions: " << write_transactions.load(std::memory_order_relaxed) << "\n"
+           << "commits: " << commits.load(std::memory_order_relaxed) << "\n"
+           << "objects_created: " << objects_created.load(std::memory_order_relaxed) << "\n"
+           << "query_executions: " << query_executions.load(std::memory_order_relaxed) << "\n"
+           << "refreshes: " << refreshes.load(std::memory_order_relaxed) << "\n"
+           << "freezes: " << freezes.load(std::memory_order_relaxed) << "\n"
+           << "active_versions: " << active_versions.load(std::memory_order_relaxed) << "\n";
+        return ss.str();
+    }
+
+    namespace {
+        std::string escape_label(const std::string& value) {
+            std::string out;
+            out.reserve(value.size());
+            for (char c : value) {
+                switch (c) {
+                    case '\\': out += "\\\\"; break;
+                    case '"': out += "\\\""; break;
+                    case '\n': out += "\\n"; break;
+                    default: out += c;
+                }
+            }
+            return out;
+        }
+    }
+
+    std::string realm_metrics::render_prometheus() {
+        std::vector<std::pair<std::string, snapshot>> snapshots;
+        for (auto& [path, metrics] : all()) {
+            snapshots.emplace_back(path, metrics->get_snapshot());
+        }
+        return render_prometheus(snapshots);
+    }
+
+    std::string realm_metrics::render_prometheus(const std::vector<std::pair<std::string, snapshot>>& snapshots) {
+        std::ostringstream ss;
+        auto family = [&](const char* name, const char* type, const char* help, auto&& write) {
+            ss << "# HELP realm_" << name << " " << help << "\n"
+               << "# TYPE realm_" << name << " " << type << "\n";
+            for (auto& [path, s] : snapshots) {
+                write("path=\"" + escape_label(path) + "\"", s);
+            }
+        };
+        auto counter = [&](const char* name, const char* help, uint64_t snapshot::*field) {
+            family(name, "counter", help, [&](const std::string& labels, const snapshot& s) {
+                ss << "realm_" << name << "{" << labels << "} " << s.*field << "\n";
+            });
+        };
+        auto gauge = [&](const char* name, const char* help, uint64_t snapshot::*field) {
+            family(name, "gauge", help, [&](const std::string& labels, const snapshot& s) {
+                ss << "realm_" << name << "{" << labels << "} " << s.*field << "\n";
+            });
+        };
+        // Buckets are cumulative and only rendered up to the highest non-empty one; the
+        // mandatory `+Inf` bucket covers the rest.
+        auto histogram = [&](const char* name, const char* help, latency_histogram::snapshot snapshot::*field) {
+            family(name, "histogram", help, [&](const std::string& labels, const snapshot& s) {
+                auto& h = s.*field;
+                size_t last = 0;
+                for (size_t i = 0; i < latency_histogram::bucket_count; i++) {
+                    if (h.buckets[i]) {
+                        last = i;
+                    }
+                }
+                uint64_t cumulative = 0;
+                for (size_t i = 0; i <= last && i + 1 < latency_histogram::bucket_count; i++) {
+                    cumulative += h.buckets[i];
+                    ss << "realm_" << name << "_bucket{" << labels << ",le=\""
+                       << latency_histogram::snapshot::upper_bound(i) << "\"} " << cumulative << "\n";
+                }
+                ss << "realm_" << name << "_bucket{" << labels << ",le=\"+Inf\"} " << h.count << "\n"
+                   << "realm_" << name << "_sum{" << labels << "} " << h.sum << "\n"
+                   << "realm_" << name << "_count{" << labels << "} " << h.count << "\n";
+            });
+        };
+
+        counter("write_transactions_total", "Write transactions begun.", &snapshot::write_transactions);
+        counter("commits_total", "Write transactions committed.", &snapshot::commits);
+        histogram("commit_duration_nanoseconds", "Time spent committing a write transaction.", &snapshot::commit_duration);
+        histogram("commit_size_bytes", "Bytes written to the file per commit.", &snapshot::commit_size);
+        counter("objects_created_total", "Objects created.", &snapshot::objects_created);
+        counter("query_executions_total", "Queries evaluated.", &snapshot::query_executions);
+        histogram("query_duration_nanoseconds", "Time spent evaluating queries.", &snapshot::query_duration);
+        counter("refreshes_total", "Explicit refreshes to the latest version.", &snapshot::refreshes);
+        counter("freezes_total", "Frozen snapshots taken.", &snapshot::freezes);
+        gauge("active_versions", "Versions retained by the file.", &snapshot::active_versions);
+        histogram("enqueue_to_run_nanoseconds", "Time between scheduling a function and it running.", &snapshot::enqueue_to_run);
+        histogram("scheduler_queue_depth", "Functions queued on the scheduler.", &snapshot::queue_depth);
+        histogram("run_duration_nanoseconds", "Time spent running scheduled functions.", &snapshot::run_duration);
+        histogram("handler_duration_nanoseconds", "Time spent in notification handlers.", &snapshot::handler_duration);
+        histogram("commit_to_notify_nanoseconds", "Time between a commit and its notification.", &snapshot::commit_to_notify);
+        return ss.str();
+    }
+
+    std::shared_ptr<realm_metrics> realm_metrics::enable(const std::string& path) {
+        auto& r = registry();
+        std::lock_guard lock(r.mutex);
+        auto& metrics = r.metrics[path];
+        if (!metrics) {
+            metrics = std::make_shared<realm_metrics>();
+            r.size.store(r.metrics.size(), std::memory_order_relaxed);
+            // Only a new entry invalidates the cached lookups.
+            r.generation.fetch_add(1, std::memory_order_release);
+        }
+        return metrics;
+    }
+
+    void realm_metrics::disable(const std::string& path) {
+        auto& r = registry();
+        std::lock_guard lock(r.mutex);
+        if (r.metrics.erase(path) == 0) {
+            return;
+        }
+        r.size.store(r.metrics.size(), std::memory_order_relaxed);
+        r.generation.fetch_add(1, std::memory_order_release);
+    }
+
+    std::shared_ptr<realm_metrics> realm_metrics::find(const std::string& path) {
+        auto& r = registry();
+        if (r.size.load(std::memory_order_relaxed) == 0) {
+            return nullptr;
+        }
+        auto generation = r.generation.load(std::memory_order_acquire);
+        if (t_lookup.generation == generation && t_lookup.path == path) {
+            return t_lookup.metrics;
+        }
+        std::lock_guard lock(r.mutex);
+        auto it = r.metrics.find(path);
+        auto metrics = it != r.metrics.end() ? it->second : nullptr;
+        t_lookup = {r.generation.load(std::memory_order_relaxed), path, metrics};
+        return metrics;
+    }
+
+    std::vector<std::pair<std::string, std::shared_ptr<realm_metrics>>> realm_metrics::all() {
+        auto& r = registry();
+        std::lock_guard lock(r.mutex);
+        return {r.metrics.begin(), r.metrics.end()};
+    }
+
+    instrumented_scheduler::instrumented_scheduler(std::shared_ptr<scheduler> scheduler,
+                                                   std::shared_ptr<realm_metrics> metrics)
+        : m_scheduler(std::move(scheduler)), m_metrics(std::move(metrics)) {}
+
+    void instrumented_scheduler::invoke(Function<void()> &&fn) {
+        auto depth = m_metrics->m_queued.fetch_add(1, std::memory_order_relaxed) + 1;
+        m_metrics->queue_depth.record(static_cast<uint64_t>(depth));
+        m_scheduler->invoke([metrics = m_metrics, enqueued = now_ns(), fn = std::move(fn)]() mutable {
+            auto start = now_ns();
+            metrics->m_queued.fetch_sub(1, std::memory_order_relaxed);
+            metrics->enqueue_to_run.record(static_cast<uint64_t>(start - enqueued));
+            fn();
+            metrics->run_duration.record(static_cast<uint64_t>(now_ns() - start));
+        });
+    }
+
+    bool instrumented_scheduler::is_on_thread() const noexcept {
+        return m_scheduler->is_on_thread();
+    }
+
+    bool instrumented_scheduler::is_same_as(const scheduler *other) const noexcept {
+        if (auto o = dynamic_cast<const instrumented_scheduler *>(other)) {
+            return m_scheduler->is_same_as(o->m_scheduler.get());
+        }
+        return m_scheduler->is_same_as(other);
+    }
+
+    bool instrumented_scheduler::can_invoke() const noexcept {
+        return m_scheduler->can_invoke();
+    }
+
+    namespace internal {
+        namespace {
+            struct instrumented_callback : bridge::collection_change_callback {
+                instrumented_callback(std::shared_ptr<bridge::collection_change_callback>&& cb,
+                                      std::shared_ptr<realm_metrics> metrics,
+                                      const std::shared_ptr<Realm>& realm)
+                    : m_cb(std::move(cb)), m_metrics(std::move(metrics)), m_realm(realm) {}
+
+                void before(const bridge::collection_change_set& c) override {
+                    m_cb->before(c);
+                }
+
+                void after(const bridge::collection_change_set& c) override {
+                    if (!c.empty()) {
+                        // Observers are called once the realm has advanced to the version
+                        // they are notified of.
+                        auto realm = m_realm.lock();
+                        auto version = realm ? realm->current_transaction_version() : util::none;
+                        if (version) {
+                            m_metrics->mark_notify(version->version);
+                        }
+                    }
+                    auto start = now_ns();
+                    m_cb->after(c);
+                    m_metrics->handler_duration.record(static_cast<uint64_t>(now_ns() - start));
+                }
+
+                std::shared_ptr<bridge::collection_change_callback> m_cb;
+                std::shared_ptr<realm_metrics> m_metrics;
+                // Weak, as the realm owns the notifier holding this callback.
+                std::weak_ptr<Realm> m_realm;
+            };
+        }
+
+        std::shared_ptr<bridge::collection_change_callback>
+        instrument_notification_callback(std::shared_ptr<bridge::collection_change_callback>&& cb,
+                                         const std::shared_ptr<Realm>& realm) {
+            if (auto metrics = realm_metrics::find(realm->config().path)) {
+                return std::make_shared<instrumented_callback>(std::move(cb), std::move(metrics), realm);
+            }
+            return std::move(cb);
+        }
+
+        void record_objects_created(const bridge::realm& realm, size_t count) {
+            if (auto metrics = realm_metrics::find(realm.path())) {
+                metrics->objects_created.fetch_add(count, std::memory_order_relaxed);
+            }
+        }
+    }
+}
@@ -0,0 +1,173 @@
+#ifndef CPP_REALM_INSTRUMENTATION_HPP
+#define CPP_REALM_INSTRUMENTATION_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cpprealm/scheduler.hpp>
+
+namespace realm {
+    class Realm;
+    namespace internal::bridge {
+        struct collection_change_callback;
+        struct realm;
+    }
+
+    // A lock-free histogram with power-of-two buckets. Bucket `i` counts values in
+    // [2^(i-1), 2^i), bucket 0 counts zero. Recording is a handful of relaxed atomic
+    // increments, so it is cheap enough to leave enabled in production.
+    struct latency_histogram {
+        static constexpr size_t bucket_count = 64;
+
+        struct snapshot {
+            std::array<uint64_t, bucket_count> buckets{};
+            uint64_t count = 0;
+            uint64_t sum = 0;
+            uint64_t max = 0;
+
+            // The exclusive upper bound of the values counted in `buckets[i]`.
+            static uint64_t upper_bound(size_t i) noexcept;
+            // An upper-bound estimate of the given percentile, in [0, 100].
+            [[nodiscard]] uint64_t percentile(double p) const noexcept;
+            [[nodiscard]] double mean() const noexcept;
+        };
+
+        void record(uint64_t value) noexcept;
+        [[nodiscard]] snapshot get_snapshot() const noexcept;
+        void reset() noexcept;
+
+    private:
+        std::array<std::atomic<uint64_t>, bucket_count> m_buckets{};
+        std::atomic<uint64_t> m_count = 0;
+        std::atomic<uint64_t> m_sum = 0;
+        std::atomic<uint64_t> m_max = 0;
+    };
+
+    // Latency, queueing and operation statistics for one realm file. Times are in nanoseconds.
+    //
+    // Metrics are registered per path with `realm_metrics::enable`, or by calling `db::metrics()`;
+    // realms whose path has no registered metrics pay a single relaxed load per transaction,
+    // query and notification registration.
+    struct realm_metrics {
+        // Time between `scheduler::invoke` and the function starting to run.
+        latency_histogram enqueue_to_run;
+        // Number of functions queued on the scheduler, sampled on each `invoke`.
+        latency_histogram queue_depth;
+        // Time spent running functions passed to `invoke`, including notification delivery.
+        latency_histogram run_duration;
+        // Time spent in notification handlers.
+        latency_histogram handler_duration;
+        // Time between a local commit and the first observer being called with its changes.
+        // Recorded once per commit; versions produced by sync or other processes are skipped.
+        latency_histogram commit_to_notify;
+
+        // Database operations. Counters are updated with relaxed atomics.
+        std::atomic<uint64_t> write_transactions = 0;
+        std::atomic<uint64_t> commits = 0;
+        // Time spent committing a write transaction.
+        latency_histogram commit_duration;
+        // Bytes written to the file per commit.
+        latency_histogram commit_size;
+        std::atomic<uint64_t> objects_created = 0;
+        // Queries evaluated, and the time spent evaluating them.
+        std::atomic<uint64_t> query_executions = 0;
+        latency_histogram query_duration;
+        std::atomic<uint64_t> refreshes = 0;
+        // Frozen snapshots taken; each pins its version until released.
+        std::atomic<uint64_t> freezes = 0;
+        // The number of versions the file currently retains, sampled by `db::metrics()`.
+        std::atomic<uint64_t> active_versions = 0;
+
+        struct snapshot {
+            latency_histogram::snapshot enqueue_to_run;
+            latency_histogram::snapshot queue_depth;
+            latency_histogram::snapshot run_duration;
+            latency_histogram::snapshot handler_duration;
+            latency_histogram::snapshot commit_to_notify;
+            uint64_t write_transactions = 0;
+            uint64_t commits = 0;
+            latency_histogram::snapshot commit_duration;
+            latency_histogram::snapshot commit_size;
+            uint64_t objects_created = 0;
+            uint64_t query_executions = 0;
+            latency_histogram::snapshot query_duration;
+            uint64_t refreshes = 0;
+            uint64_t freezes = 0;
+            uint64_t active_versions = 0;
+        };
+        [[nodiscard]] snapshot get_snapshot() const noexcept;
+
+        // Notes that this process committed `version`.
+        void mark_commit(uint64_t version);
+        // Records `commit_to_notify` for the local commits up to `version`, which an observer
+        // has just been notified of, unless an earlier notification already did.
+        void mark_notify(uint64_t version);
+
+        // Human readable summary, suitable for logging.
+        [[nodiscard]] std::string to_string() const;
+
+        // Renders the metrics of every registered path in the Prometheus text exposition
+        // format, labelled with `path`, e.g. to be served from an application's own
+        // metrics endpoint.
+        static std::string render_prometheus();
+        static std::string render_prometheus(const std::vector<std::pair<std::string, snapshot>>& snapshots);
+
+        // Returns the metrics for `path`, creating and registering them if needed.
+        static std::shared_ptr<realm_metrics> enable(const std::string& path);
+        static void disable(const std::string& path);
+        // Returns the metrics for `path`, or nullptr if none are registered.
+        static std::shared_ptr<realm_metrics> find(const std::string& path);
+        static std::vector<std::pair<std::string, std::shared_ptr<realm_metrics>>> all();
+
+    private:
+        friend struct instrumented_scheduler;
+        std::atomic<int64_t> m_queued = 0;
+        // When each local commit not yet notified was made, by version.
+        std::mutex m_commits_mutex;
+        std::map<uint64_t, int64_t> m_commit_times;
+    };
+
+    // Decorates a scheduler to record enqueue-to-run latency, queue depth and run duration
+    // into `metrics`.
+    //
+    //     auto metrics = realm_metrics::enable(config.path());
+    //     config.set_scheduler(std::make_shared<instrumented_scheduler>(scheduler::make_default(), metrics));
+    struct instrumented_scheduler final : public scheduler {
+        instrumented_scheduler(std::shared_ptr<scheduler> scheduler, std::shared_ptr<realm_metrics> metrics);
+        ~instrumented_scheduler() final = default;
+
+        void invoke(Function<void()> &&) override;
+        [[nodiscard]] bool is_on_thread() const noexcept override;
+        bool is_same_as(const scheduler *other) const noexcept override;
+        [[nodiscard]] bool can_invoke() const noexcept override;
+
+        [[nodiscard]] const std::shared_ptr<realm_metrics>& metrics() const noexcept {
+            return m_metrics;
+        }
+
+    private:
+        std::shared_ptr<scheduler> m_scheduler;
+        std::shared_ptr<realm_metrics> m_metrics;
+    };
+
+    namespace internal {
+        // Wraps `cb` to record handler duration and commit-to-notify latency if metrics are
+        // enabled for the path of `realm`, otherwise returns `cb` unchanged.
+        std::shared_ptr<bridge::collection_change_callback>
+        instrument_notification_callback(std::shared_ptr<bridge::collection_change_callback>&& cb,
+                                         const std::shared_ptr<Realm>& realm);
+
+        // Counts objects created in `realm` if metrics are enabled for its path.
+        void record_objects_created(const bridge::realm& realm, size_t count);
+    }
+}
+
+#endif //CPP_REALM_INSTRUMENTATION_HPP
@@ -63,6 +63,7 @@ void DefaultTransport::send_request_to_server(const app::Request& request,
             [urlRequest setHTTPBody:[[NSString stringWithCString:request.body.c_str() encoding:NSUTF8StringEncoding]
                     dataUsingEncoding:NSUTF8StringEncoding]];
         }
+        s_counters.requests.fetch_add(1, std::memory_order_relaxed);
         NSURLSession *session = [NSURLSession sharedSession];
         NSURLSessionDataTask *dataTask = [session dataTaskWithRequest:urlRequest
                                                     completionHandler:[request = std::move(request),
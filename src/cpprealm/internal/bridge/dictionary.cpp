@@ -1,10 +1,13 @@
 #include <cpprealm/internal/bridge/dictionary.hpp>
+#include <cpprealm/instrumentation.hpp>
 #include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/object.hpp>
+#include <cpprealm/tracing.hpp>
 
 #include <realm/object-store/dictionary.hpp>
 #include <realm/object-store/results.hpp>
+#include <realm/object-store/shared_realm.hpp>
 
 namespace realm::internal::bridge {
 
@@ -83,12 +86,19 @@ namespace realm::internal::bridge {
         return *get_dictionary();
     }
 
-    void core_dictionary::insert(const std::string& key, const mixed& value) {
-        get_dictionary()->insert(key, value.operator Mixed());
+    void core_dictionary::insert(std::string_view key, const mixed& value) {
+        get_dictionary()->insert(StringData(key.data(), key.size()), value.operator Mixed());
     }
 
-    void core_dictionary::insert(const std::string& key, const std::string& value) {
-        get_dictionary()->insert(key, value);
+    void core_dictionary::insert(std::string_view key, const std::string& value) {
+        get_dictionary()->insert(StringData(key.data(), key.size()), StringData(value));
+    }
+
+    void core_dictionary::insert(const std::vector<std::pair<std::string, mixed>>& values) {
+        auto dictionary = get_dictionary();
+        for (auto& [key, value] : values) {
+            dictionary->insert(StringData(key), value.operator Mixed());
+        }
     }
 
     obj core_dictionary::create_and_insert_linked_object(const std::string& key, const internal::bridge::mixed& pk) {
@@ -102,12 +112,12 @@ namespace realm::internal::bridge {
         return get_dictionary()->create_and_insert_linked_object(key);
     }
 
-    mixed core_dictionary::get(const std::string& key) const {
-        return get_dictionary()->get(key);
+    mixed core_dictionary::get(std::string_view key) const {
+        return get_dictionary()->get(StringData(key.data(), key.size()));
     }
 
-    void core_dictionary::erase(const std::string& key) {
-        get_dictionary()->erase(key);
+    void core_dictionary::erase(std::string_view key) {
+        get_dictionary()->erase(StringData(key.data(), key.size()));
     }
 
     obj core_dictionary::get_object(const std::string& key) {
@@ -122,8 +132,21 @@ namespace realm::internal::bridge {
         return get_dictionary()->get_pair(ndx);
     }
 
-    size_t core_dictionary::find_any_key(const std::string& value) const noexcept {
-        return get_dictionary()->find_any_key(value);
+    std::string_view core_dictionary::get_key(size_t ndx) const {
+        auto key = get_dictionary()->get_key(ndx).get_string();
+        return std::string_view(key.data(), key.size());
+    }
+
+    mixed core_dictionary::get_value(size_t ndx) const {
+        return get_dictionary()->get_any(ndx);
+    }
+
+    size_t core_dictionary::find_any_key(std::string_view value) const noexcept {
+        return get_dictionary()->find_any_key(StringData(value.data(), value.size()));
+    }
+
+    bool core_dictionary::contains(std::string_view key) const {
+        return get_dictionary()->contains(StringData(key.data(), key.size()));
     }
 
     dictionary::dictionary() {
@@ -303,6 +326,7 @@ namespace realm::internal::bridge {
     }
 
     notification_token dictionary::add_notification_callback(std::shared_ptr<collection_change_callback>&& cb) {
+        cb = internal::instrument_notification_callback(std::move(cb), get_dictionary()->get_realm());
         struct wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
             explicit wrapper(std::shared_ptr<collection_change_callback>&& cb)
@@ -311,6 +335,7 @@ namespace realm::internal::bridge {
                 m_cb->before(v);
             }
             void after(const CollectionChangeSet& v) const {
+                CPPREALM_TRACE_SCOPE("notifications", "notify");
                 m_cb->after(v);
             }
         } ccb(std::move(cb));
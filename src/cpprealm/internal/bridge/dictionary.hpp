@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cpprealm/internal/bridge/utils.hpp>
 
@@ -95,15 +96,21 @@ namespace realm::internal::bridge {
 
         core_dictionary(const CoreDictionary& v); //NOLINT(google-explicit-constructor)
         operator CoreDictionary () const; //NOLINT(google-explicit-constructor)
-        void insert(const std::string& key, const mixed& value);
-        void insert(const std::string& key, const std::string& value);
+        void insert(std::string_view key, const mixed& value);
+        void insert(std::string_view key, const std::string& value);
+        void insert(const std::vector<std::pair<std::string, mixed>>& values);
         obj create_and_insert_linked_object(const std::string& key);
         obj create_and_insert_linked_object(const std::string& key, const internal::bridge::mixed& pk);
-        mixed get(const std::string& key) const;
-        void erase(const std::string& key);
+        mixed get(std::string_view key) const;
+        void erase(std::string_view key);
         obj get_object(const std::string& key);
         std::pair<mixed, mixed> get_pair(size_t ndx) const;
-        size_t find_any_key(const std::string& value) const noexcept;
+        // The returned view points into the Realm file and is only valid
+        // until the next write or refresh.
+        std::string_view get_key(size_t ndx) const;
+        mixed get_value(size_t ndx) const;
+        size_t find_any_key(std::string_view value) const noexcept;
+        bool contains(std::string_view key) const;
 
         size_t size() const;
     private:
@@ -1,14 +1,62 @@
 #include <cpprealm/internal/bridge/list.hpp>
 
+#include <cpprealm/instrumentation.hpp>
+#include <cpprealm/internal/bridge/binary.hpp>
 #include <cpprealm/internal/bridge/col_key.hpp>
+#include <cpprealm/internal/bridge/decimal128.hpp>
 #include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
+#include <cpprealm/internal/bridge/object_id.hpp>
 #include <cpprealm/internal/bridge/table.hpp>
+#include <cpprealm/internal/bridge/timestamp.hpp>
+#include <cpprealm/internal/bridge/uuid.hpp>
+#include <cpprealm/tracing.hpp>
 
 #include <realm/object-store/list.hpp>
+#include <realm/object-store/shared_realm.hpp>
 
 namespace realm::internal::bridge {
 
+    namespace {
+        Mixed to_core_value(const std::string& v) { return StringData(v); }
+        Mixed to_core_value(const int64_t& v) { return v; }
+        Mixed to_core_value(const double& v) { return v; }
+        Mixed to_core_value(const bool& v) { return v; }
+        Mixed to_core_value(const binary& v) { return static_cast<BinaryData>(v); }
+        Mixed to_core_value(const uuid& v) { return static_cast<UUID>(v); }
+        Mixed to_core_value(const object_id& v) { return static_cast<ObjectId>(v); }
+        Mixed to_core_value(const decimal128& v) { return static_cast<Decimal128>(v); }
+        Mixed to_core_value(const mixed& v) { return v.operator ::realm::Mixed(); }
+        Mixed to_core_value(const timestamp& v) { return v.operator Timestamp(); }
+        template <typename T>
+        Mixed to_core_value(const std::optional<T>& v) {
+            return v ? to_core_value(*v) : Mixed();
+        }
+
+        template <typename T>
+        void insert_values(List& lst, size_t pos, const std::vector<T>& values) {
+            for (size_t i = 0; i < values.size(); ++i) {
+                lst.insert_any(pos + i, to_core_value(values[i]));
+            }
+        }
+
+        template <typename T>
+        void assign_values(List& lst, const std::vector<T>& values) {
+            size_t size = lst.size();
+            const size_t count = values.size();
+            while (size > count) {
+                lst.remove(--size);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                if (i < size) {
+                    lst.set_any(i, to_core_value(values[i]));
+                } else {
+                    lst.insert_any(i, to_core_value(values[i]));
+                }
+            }
+        }
+    }
+
     list::list() {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         new (&m_list) List();
@@ -126,6 +174,12 @@ namespace realm::internal::bridge {
     void list::remove(size_t idx) {
         get_list()->remove(idx);
     }
+    void list::remove(size_t from, size_t to) {
+        auto lst = get_list();
+        for (size_t i = to; i > from; --i) {
+            lst->remove(i - 1);
+        }
+    }
     void list::remove_all() {
         get_list()->remove_all();
     }
@@ -280,6 +334,46 @@ namespace realm::internal::bridge {
     void list::set(size_t pos, const binary &v) { get_list()->set(pos, static_cast<BinaryData>(v)); }
     void list::set(size_t pos, const timestamp &v) { get_list()->set(pos, v.operator Timestamp()); }
 
+    void list::insert(size_t pos, const std::vector<std::string>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<int64_t>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<double>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<bool>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<binary>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<uuid>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<object_id>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<decimal128>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<mixed>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<timestamp>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<std::optional<std::string>>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<std::optional<int64_t>>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<std::optional<double>>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<std::optional<bool>>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<std::optional<binary>>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<std::optional<uuid>>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<std::optional<object_id>>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<std::optional<decimal128>>& v) { insert_values(*get_list(), pos, v); }
+    void list::insert(size_t pos, const std::vector<std::optional<timestamp>>& v) { insert_values(*get_list(), pos, v); }
+
+    void list::assign(const std::vector<std::string>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<int64_t>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<double>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<bool>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<binary>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<uuid>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<object_id>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<decimal128>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<mixed>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<timestamp>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<std::optional<std::string>>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<std::optional<int64_t>>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<std::optional<double>>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<std::optional<bool>>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<std::optional<binary>>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<std::optional<uuid>>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<std::optional<object_id>>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<std::optional<decimal128>>& v) { assign_values(*get_list(), v); }
+    void list::assign(const std::vector<std::optional<timestamp>>& v) { assign_values(*get_list(), v); }
+
     size_t list::find(const int64_t &v) { return get_list()->find(v); }
     size_t list::find(const bool &v) { return get_list()->find(v); }
     size_t list::find(const double &v) { return get_list()->find(v); }
@@ -298,6 +392,7 @@ namespace realm::internal::bridge {
     size_t list::find(const obj_key& v) { return get_list()->find(static_cast<ObjKey>(v)); }
 
     notification_token list::add_notification_callback(std::shared_ptr<collection_change_callback> cb) {
+        cb = internal::instrument_notification_callback(std::move(cb), get_list()->get_realm());
         struct wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
             explicit wrapper(std::shared_ptr<collection_change_callback>&& cb)
@@ -306,6 +401,7 @@ namespace realm::internal::bridge {
                 m_cb->before(v);
             }
             void after(const CollectionChangeSet& v) const {
+                CPPREALM_TRACE_SCOPE("notifications", "notify");
                 m_cb->after(v);
             }
         } ccb(std::move(cb));
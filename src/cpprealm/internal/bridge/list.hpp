@@ -5,6 +5,7 @@
 #include <string>
 #include <memory>
 #include <optional>
+#include <vector>
 #include <cpprealm/internal/bridge/utils.hpp>
 
 namespace realm {
@@ -45,6 +46,8 @@ namespace realm::internal::bridge {
 
         [[nodiscard]] size_t size() const;
         void remove(size_t idx);
+        /// Removes the elements in the range [from, to).
+        void remove(size_t from, size_t to);
         void remove_all();
 
         table get_table() const;
@@ -73,6 +76,50 @@ namespace realm::internal::bridge {
         void set(size_t pos, const timestamp &);
         void set(size_t pos, const binary &);
 
+        /// Inserts all `values` starting at `pos` in a single pass.
+        void insert(size_t pos, const std::vector<std::string>&);
+        void insert(size_t pos, const std::vector<int64_t>&);
+        void insert(size_t pos, const std::vector<double>&);
+        void insert(size_t pos, const std::vector<bool>&);
+        void insert(size_t pos, const std::vector<binary>&);
+        void insert(size_t pos, const std::vector<uuid>&);
+        void insert(size_t pos, const std::vector<object_id>&);
+        void insert(size_t pos, const std::vector<decimal128>&);
+        void insert(size_t pos, const std::vector<mixed>&);
+        void insert(size_t pos, const std::vector<timestamp>&);
+        void insert(size_t pos, const std::vector<std::optional<std::string>>&);
+        void insert(size_t pos, const std::vector<std::optional<int64_t>>&);
+        void insert(size_t pos, const std::vector<std::optional<double>>&);
+        void insert(size_t pos, const std::vector<std::optional<bool>>&);
+        void insert(size_t pos, const std::vector<std::optional<binary>>&);
+        void insert(size_t pos, const std::vector<std::optional<uuid>>&);
+        void insert(size_t pos, const std::vector<std::optional<object_id>>&);
+        void insert(size_t pos, const std::vector<std::optional<decimal128>>&);
+        void insert(size_t pos, const std::vector<std::optional<timestamp>>&);
+
+        /// Replaces the contents of the list with `values`. Existing slots are
+        /// overwritten in place so observers see modifications rather than a
+        /// delete followed by an insert.
+        void assign(const std::vector<std::string>&);
+        void assign(const std::vector<int64_t>&);
+        void assign(const std::vector<double>&);
+        void assign(const std::vector<bool>&);
+        void assign(const std::vector<binary>&);
+        void assign(const std::vector<uuid>&);
+        void assign(const std::vector<object_id>&);
+        void assign(const std::vector<decimal128>&);
+        void assign(const std::vector<mixed>&);
+        void assign(const std::vector<timestamp>&);
+        void assign(const std::vector<std::optional<std::string>>&);
+        void assign(const std::vector<std::optional<int64_t>>&);
+        void assign(const std::vector<std::optional<double>>&);
+        void assign(const std::vector<std::optional<bool>>&);
+        void assign(const std::vector<std::optional<binary>>&);
+        void assign(const std::vector<std::optional<uuid>>&);
+        void assign(const std::vector<std::optional<object_id>>&);
+        void assign(const std::vector<std::optional<decimal128>>&);
+        void assign(const std::vector<std::optional<timestamp>>&);
+
         size_t find(const int64_t &);
         size_t find(const bool &);
         size_t find(const double &);
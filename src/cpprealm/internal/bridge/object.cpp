@@ -1,15 +1,28 @@
 #include <cpprealm/internal/bridge/obj.hpp>
 
+#include <cpprealm/instrumentation.hpp>
 #include <cpprealm/internal/bridge/dictionary.hpp>
 #include <cpprealm/internal/bridge/list.hpp>
 #include <cpprealm/internal/bridge/obj_key.hpp>
 #include <cpprealm/internal/bridge/object.hpp>
 #include <cpprealm/internal/bridge/object_schema.hpp>
 #include <cpprealm/internal/bridge/realm.hpp>
+#include <cpprealm/internal/bridge/table.hpp>
+#include <cpprealm/tracing.hpp>
 
 #include <realm/object-store/dictionary.hpp>
+#include <realm/object-store/impl/collection_change_builder.hpp>
 #include <realm/object-store/list.hpp>
 #include <realm/object-store/object.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/object-store/util/scheduler.hpp>
+#include <realm/table.hpp>
+#include <realm/version_numbers.hpp>
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
 
 namespace realm::internal::bridge {
     object::object() {
@@ -126,7 +139,31 @@ namespace realm::internal::bridge {
         return *m_object;
 #endif
     }
+
+    std::optional<KeyPathArray> to_core_key_path_array(const key_path_array& key_paths) {
+        if (key_paths.empty()) {
+            return std::nullopt;
+        }
+        KeyPathArray ret;
+        ret.reserve(key_paths.size());
+        for (auto& path : key_paths) {
+            KeyPath key_path;
+            key_path.reserve(path.size());
+            for (auto& [table_key, col_key] : path) {
+                key_path.emplace_back(TableKey(table_key), ColKey(col_key));
+            }
+            ret.push_back(std::move(key_path));
+        }
+        return ret;
+    }
+
     notification_token object::add_notification_callback(std::shared_ptr<collection_change_callback>&& cb) {
+        return add_notification_callback(std::move(cb), key_path_array());
+    }
+
+    notification_token object::add_notification_callback(std::shared_ptr<collection_change_callback>&& cb,
+                                                         const key_path_array& key_paths) {
+        cb = internal::instrument_notification_callback(std::move(cb), static_cast<std::shared_ptr<Realm>>(get_realm()));
         struct wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
             explicit wrapper(std::shared_ptr<collection_change_callback>&& cb)
@@ -135,16 +172,58 @@ namespace realm::internal::bridge {
                 m_cb->before(v);
             }
             void after(const CollectionChangeSet& v) const {
+                CPPREALM_TRACE_SCOPE("notifications", "notify");
                 m_cb->after(v);
             }
         } ccb(std::move(cb));
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
-        return reinterpret_cast<Object*>(&m_object)->add_notification_callback(ccb);
+        return reinterpret_cast<Object*>(&m_object)->add_notification_callback(ccb, to_core_key_path_array(key_paths));
 #else
-        return m_object->add_notification_callback(ccb);
+        return m_object->add_notification_callback(ccb, to_core_key_path_array(key_paths));
 #endif
     }
 
+    namespace {
+        // Whether `col_key` holds links, alone or in a list, set or dictionary.
+        bool is_link(ColKey col_key) {
+#if REALM_VERSION_MAJOR < 14
+            if (col_key.get_type() == col_type_LinkList) {
+                return true;
+            }
+#endif
+            return col_key.get_type() == col_type_Link;
+        }
+    }
+
+    key_path_array make_key_path_array(const table& t, const std::vector<std::string>& key_paths) {
+        key_path_array ret;
+        ret.reserve(key_paths.size());
+        for (auto& path : key_paths) {
+            TableRef current = static_cast<TableRef>(t);
+            std::vector<std::pair<uint32_t, int64_t>> resolved;
+            size_t begin = 0;
+            while (true) {
+                auto end = path.find('.', begin);
+                auto name = std::string_view(path).substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+                if (!current) {
+                    throw std::invalid_argument("Key path '" + path + "' continues past a property which is not a link.");
+                }
+                ColKey col_key = current->get_column_key(StringData(name.data(), name.size()));
+                if (!col_key) {
+                    throw std::invalid_argument("Property '" + std::string(name) + "' in key path '" + path + "' does not exist.");
+                }
+                resolved.emplace_back(current->get_key().value, col_key.value);
+                if (end == std::string::npos) {
+                    break;
+                }
+                current = is_link(col_key) ? current->get_link_target(col_key) : TableRef();
+                begin = end + 1;
+            }
+            ret.push_back(std::move(resolved));
+        }
+        return ret;
+    }
+
     bool index_set::empty() const {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<const IndexSet*>(&m_idx_set)->empty();
@@ -254,6 +333,194 @@ namespace realm::internal::bridge {
 #endif
     }
 
+    namespace {
+        _impl::CollectionChangeBuilder to_builder(const CollectionChangeSet& c) {
+            _impl::CollectionChangeBuilder builder(c.deletions, c.insertions, c.modifications, c.moves,
+                                                   c.collection_root_was_deleted);
+            builder.columns = c.columns;
+            return builder;
+        }
+    }
+
+    void collection_change_set::merge(const collection_change_set& next) {
+        CollectionChangeSet lhs = *this;
+        CollectionChangeSet rhs = next;
+        auto builder = to_builder(lhs);
+        builder.merge(to_builder(rhs));
+        auto merged = std::move(builder).finalize();
+        merged.collection_root_was_deleted = lhs.collection_root_was_deleted || rhs.collection_root_was_deleted;
+        *this = collection_change_set(merged);
+    }
+
+    namespace {
+        // Runs the deferred flushes of every coalescing callback in the process on one thread.
+        // Entries only hold their scheduler weakly, so a realm that closes while a flush is
+        // pending is neither kept alive nor called back. The thread is joined at static
+        // destruction, dropping anything still pending.
+        class flush_timer {
+        public:
+            static flush_timer& shared() {
+                static flush_timer timer;
+                return timer;
+            }
+
+            ~flush_timer() {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_stopped = true;
+                }
+                m_cv.notify_one();
+                if (m_thread.joinable()) {
+                    m_thread.join();
+                }
+            }
+
+            void schedule(std::chrono::steady_clock::time_point due, std::weak_ptr<util::Scheduler> scheduler,
+                          util::UniqueFunction<void()>&& fn) {
+                {
+                    std::lock_guard lock(m_mutex);
+                    if (m_stopped) {
+                        return;
+                    }
+                    m_entries.emplace(due, entry{std::move(scheduler), std::move(fn)});
+                    if (!m_thread.joinable()) {
+                        m_thread = std::thread([this] {
+                            run();
+                        });
+                    }
+                }
+                m_cv.notify_one();
+            }
+
+        private:
+            struct entry {
+                std::weak_ptr<util::Scheduler> scheduler;
+                util::UniqueFunction<void()> fn;
+            };
+
+            void run() {
+                std::unique_lock lock(m_mutex);
+                while (!m_stopped) {
+                    if (m_entries.empty()) {
+                        m_cv.wait(lock);
+                        continue;
+                    }
+                    auto it = m_entries.begin();
+                    if (it->first > std::chrono::steady_clock::now()) {
+                        m_cv.wait_until(lock, it->first);
+                        continue;
+                    }
+                    auto e = std::move(it->second);
+                    m_entries.erase(it);
+                    lock.unlock();
+                    if (auto scheduler = e.scheduler.lock()) {
+                        scheduler->invoke(std::move(e.fn));
+                    }
+                    lock.lock();
+                }
+            }
+
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::multimap<std::chrono::steady_clock::time_point, entry> m_entries;
+            bool m_stopped = false;
+            std::thread m_thread;
+        };
+
+        struct coalescing_callback : collection_change_callback, std::enable_shared_from_this<coalescing_callback> {
+            coalescing_callback(std::shared_ptr<collection_change_callback>&& cb,
+                                std::weak_ptr<util::Scheduler> scheduler,
+                                std::chrono::milliseconds min_interval,
+                                size_t max_pending_commits)
+                : m_cb(std::move(cb)), m_scheduler(std::move(scheduler)),
+                  m_min_interval(min_interval), m_max_pending_commits(max_pending_commits) {}
+
+            void before(const collection_change_set&) override {}
+
+            void after(const collection_change_set& c) override {
+                // The initial notification is never held back.
+                if (!m_delivered_initial) {
+                    m_delivered_initial = true;
+                    deliver(c);
+                    return;
+                }
+                if (c.empty()) {
+                    return;
+                }
+                if (m_pending_commits == 0) {
+                    m_pending = c;
+                } else {
+                    m_pending.merge(c);
+                }
+                ++m_pending_commits;
+                if (m_max_pending_commits && m_pending_commits >= m_max_pending_commits) {
+                    flush();
+                } else {
+                    schedule_flush();
+                }
+            }
+
+        private:
+            void deliver(const collection_change_set& c) {
+                m_last_delivery = std::chrono::steady_clock::now();
+                m_cb->after(c);
+            }
+
+            void flush() {
+                if (m_pending_commits == 0) {
+                    return;
+                }
+                auto changes = std::move(m_pending);
+                m_pending = collection_change_set();
+                m_pending_commits = 0;
+                deliver(changes);
+            }
+
+            void schedule_flush() {
+                if (m_flush_scheduled) {
+                    return;
+                }
+                m_flush_scheduled = true;
+                std::weak_ptr<coalescing_callback> weak_self = shared_from_this();
+                util::UniqueFunction<void()> run = [weak_self] {
+                    if (auto self = weak_self.lock()) {
+                        self->m_flush_scheduled = false;
+                        self->flush();
+                    }
+                };
+                auto due = m_last_delivery + m_min_interval;
+                if (due <= std::chrono::steady_clock::now()) {
+                    if (auto scheduler = m_scheduler.lock()) {
+                        scheduler->invoke(std::move(run));
+                    }
+                    return;
+                }
+                // util::Scheduler has no timers, so wait out the interval on the shared
+                // timer thread and hop back onto the scheduler to deliver.
+                flush_timer::shared().schedule(due, m_scheduler, std::move(run));
+            }
+
+            std::shared_ptr<collection_change_callback> m_cb;
+            std::weak_ptr<util::Scheduler> m_scheduler;
+            std::chrono::milliseconds m_min_interval;
+            size_t m_max_pending_commits;
+            collection_change_set m_pending;
+            size_t m_pending_commits = 0;
+            bool m_flush_scheduled = false;
+            bool m_delivered_initial = false;
+            std::chrono::steady_clock::time_point m_last_delivery;
+        };
+    }
+
+    std::shared_ptr<collection_change_callback> make_coalescing_callback(std::shared_ptr<collection_change_callback>&& cb,
+                                                                         const realm& realm,
+                                                                         std::chrono::milliseconds min_interval,
+                                                                         size_t max_pending_commits) {
+        return std::make_shared<coalescing_callback>(std::move(cb),
+                                                     static_cast<std::shared_ptr<Realm>>(realm)->scheduler(),
+                                                     min_interval, max_pending_commits);
+    }
+
     notification_token::notification_token() {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         new (&m_token) NotificationToken();
@@ -520,6 +787,15 @@ namespace realm::internal::bridge {
         return iter;
     }
 
+    std::vector<std::pair<size_t, size_t>> index_set::ranges() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto& idx_set = *reinterpret_cast<const IndexSet*>(&m_idx_set);
+#else
+        auto& idx_set = *m_idx_set;
+#endif
+        return std::vector<std::pair<size_t, size_t>>(idx_set.begin(), idx_set.end());
+    }
+
     index_set::index_iterable_adaptor index_set::as_indexes() const {
         index_iterable_adaptor iter;
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
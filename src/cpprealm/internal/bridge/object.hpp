@@ -2,14 +2,21 @@
 #define CPP_REALM_BRIDGE_OBJECT_HPP
 
 #include <any>
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <cpprealm/internal/bridge/utils.hpp>
 
 namespace realm {
     class Object;
+    struct TableKey;
+    struct ColKey;
     class IndexSet;
     class CollectionChangeCallback;
     struct CollectionChangeSet;
@@ -23,6 +30,18 @@ namespace realm::internal::bridge {
     struct list;
     struct col_key;
     struct dictionary;
+    struct table;
+
+    // Each key path is a list of (table key, column key) pairs, starting at the observed type.
+    using key_path_array = std::vector<std::vector<std::pair<uint32_t, int64_t>>>;
+    // Resolves dotted property paths such as "owner.name" against `table`. A path may go on
+    // through links and through lists, sets and dictionaries of links; not through backlinks
+    // or mixed values.
+    key_path_array make_key_path_array(const table&, const std::vector<std::string>& key_paths);
+    // Converts resolved key paths to the database's `KeyPathArray`, or nullopt to observe
+    // every property.
+    std::optional<std::vector<std::vector<std::pair<TableKey, ColKey>>>>
+    to_core_key_path_array(const key_path_array& key_paths);
 
     struct notification_token {
         notification_token();
@@ -98,6 +117,8 @@ namespace realm::internal::bridge {
 #endif
         };
         index_iterable_adaptor as_indexes() const;
+        // The [begin, end) runs backing the set.
+        [[nodiscard]] std::vector<std::pair<size_t, size_t>> ranges() const;
     private:
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         storage::IndexSet m_idx_set[1];
@@ -120,6 +141,8 @@ namespace realm::internal::bridge {
         [[nodiscard]] std::unordered_map<int64_t, index_set> columns() const;
         [[nodiscard]] bool empty() const;
         [[nodiscard]] bool collection_root_was_deleted() const;
+        // Folds a later change set into this one, shifting indices as if both were a single commit.
+        void merge(const collection_change_set& next);
     private:
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         storage::CollectionChangeSet m_change_set[1];
@@ -132,6 +155,14 @@ namespace realm::internal::bridge {
         virtual void after(collection_change_set const& c) = 0;
     };
 
+    // Wraps `cb` so that change sets are merged and delivered at most once per `min_interval`,
+    // or as soon as `max_pending_commits` commits have accumulated. Deferred deliveries are posted
+    // to the scheduler of `realm`; a zero interval coalesces the commits seen in one run loop pass.
+    std::shared_ptr<collection_change_callback> make_coalescing_callback(std::shared_ptr<collection_change_callback>&& cb,
+                                                                         const realm& realm,
+                                                                         std::chrono::milliseconds min_interval,
+                                                                         size_t max_pending_commits);
+
     struct object {
         object(); //NOLINT(google-explicit-constructor)
         object(const object& other) ;
@@ -152,6 +183,8 @@ namespace realm::internal::bridge {
         [[nodiscard]] bool is_valid() const;
 
         notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&& cb);
+        notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&& cb,
+                                                     const key_path_array& key_paths);
 
         [[nodiscard]] object_schema get_object_schema() const;
 
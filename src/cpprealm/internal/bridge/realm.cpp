@@ -13,9 +13,13 @@
 #include <cpprealm/internal/bridge/table.hpp>
 #include <cpprealm/internal/bridge/thread_safe_reference.hpp>
 #include <cpprealm/logger.hpp>
+#include <cpprealm/instrumentation.hpp>
 #include <cpprealm/scheduler.hpp>
+#include <cpprealm/tracing.hpp>
 
+#include <realm/db.hpp>
 #include <realm/object-store/dictionary.hpp>
+#include <realm/object-store/object_store.hpp>
 #include <realm/object-store/schema.hpp>
 #include <realm/object-store/shared_realm.hpp>
 #include <realm/object-store/sync/sync_session.hpp>
@@ -23,8 +27,12 @@
 #include <realm/object-store/thread_safe_reference.hpp>
 #include <realm/object-store/util/scheduler.hpp>
 #include <realm/sync/config.hpp>
+#include <realm/transaction.hpp>
 
+#include <algorithm>
 #include <filesystem>
+#include <map>
+#include <mutex>
 
 namespace realm::internal::bridge {
     static_assert((uint8_t)realm::config::schema_mode::Automatic == (uint8_t)::realm::SchemaMode::Automatic);
@@ -50,10 +58,88 @@ namespace realm::internal::bridge {
     }
     void realm::begin_transaction() const {
         m_realm->begin_transaction();
+        if (auto metrics = realm_metrics::find(m_realm->config().path)) {
+            metrics->write_transactions.fetch_add(1, std::memory_order_relaxed);
+        }
     }
 
     void realm::commit_transaction() const {
+        CPPREALM_TRACE_SCOPE("db", "commit");
+        auto metrics = realm_metrics::find(m_realm->config().path);
+        if (!metrics) {
+            m_realm->commit_transaction();
+            return;
+        }
+        // The size of the changes must be read before they are committed.
+        auto size = static_cast<Transaction&>(m_realm->read_group()).get_commit_size();
+        auto start = std::chrono::steady_clock::now();
         m_realm->commit_transaction();
+        metrics->commit_duration.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+        metrics->commit_size.record(size);
+        metrics->commits.fetch_add(1, std::memory_order_relaxed);
+        if (auto version = m_realm->current_transaction_version()) {
+            metrics->mark_commit(version->version);
+        }
+    }
+
+    const std::string& realm::path() const {
+        return m_realm->config().path;
+    }
+
+    uint64_t realm::get_number_of_versions() const {
+        return m_realm->get_number_of_versions();
+    }
+
+    namespace {
+        // The oldest version of each file seen by `get_file_stats`, and when it was first seen.
+        struct oldest_version_registry {
+            std::mutex mutex;
+            std::map<std::string, std::pair<uint64_t, std::chrono::steady_clock::time_point>> versions;
+        };
+
+        oldest_version_registry& oldest_versions() {
+            static oldest_version_registry r;
+            return r;
+        }
+    }
+
+    realm::file_stats realm::get_file_stats(bool table_sizes) const {
+        auto& transaction = static_cast<Transaction&>(m_realm->read_group());
+        auto db = transaction.get_db();
+        file_stats stats;
+        std::error_code ec;
+        stats.file_size = std::filesystem::file_size(m_realm->config().path, ec);
+        size_t free_size = 0, used_size = 0;
+        db->get_stats(free_size, used_size);
+        stats.free_size = free_size;
+        stats.used_size = used_size;
+        stats.version_count = db->get_number_of_versions();
+        stats.latest_version = db->get_version_of_latest_snapshot();
+        // Versions are retained from the oldest one still in use up to the latest.
+        stats.oldest_version = stats.latest_version + 1 - std::min(stats.version_count, stats.latest_version);
+        {
+            auto& r = oldest_versions();
+            auto now = std::chrono::steady_clock::now();
+            std::lock_guard lock(r.mutex);
+            auto& [version, seen] = r.versions[m_realm->config().path];
+            if (version != stats.oldest_version) {
+                version = stats.oldest_version;
+                seen = now;
+            }
+            stats.oldest_version_age = std::chrono::duration_cast<std::chrono::milliseconds>(now - seen);
+        }
+
+        for (auto key : transaction.get_table_keys()) {
+            auto table = transaction.get_table(key);
+            auto name = ObjectStore::object_type_for_table_name(table->get_name());
+            if (name.empty()) {
+                continue;
+            }
+            stats.tables.push_back({std::string(name), table->size(),
+                                    table_sizes ? table->compute_aggregated_byte_size() : 0});
+        }
+        return stats;
     }
 
     struct internal_scheduler : util::Scheduler {
@@ -64,7 +150,14 @@ namespace realm::internal::bridge {
 
         ~internal_scheduler() override = default;
         void invoke(util::UniqueFunction<void ()> &&fn) override {
+#ifdef CPPREALM_ENABLE_TRACING
+            m_scheduler->invoke([fn = std::move(fn)]() mutable {
+                CPPREALM_TRACE_SCOPE("scheduler", "scheduler::invoke");
+                fn();
+            });
+#else
             m_scheduler->invoke(std::move(fn));
+#endif
         }
 
         bool is_on_thread() const noexcept override {
@@ -366,16 +459,34 @@ namespace realm::internal::bridge {
     }
 
     bool realm::refresh() {
+        if (auto metrics = realm_metrics::find(m_realm->config().path)) {
+            metrics->refreshes.fetch_add(1, std::memory_order_relaxed);
+        }
         return m_realm->refresh();
     }
 
+    realm realm::freeze() const {
+        if (auto metrics = realm_metrics::find(m_realm->config().path)) {
+            metrics->freezes.fetch_add(1, std::memory_order_relaxed);
+        }
+        return m_realm->freeze();
+    }
+
+    bool realm::is_frozen() const {
+        return m_realm->is_frozen();
+    }
+
+    bool realm::is_in_transaction() const {
+        return m_realm->is_in_transaction();
+    }
+
     [[nodiscard]] std::optional<sync_session> realm::get_sync_session() const {
         auto& config = m_realm->config().sync_config;
         if (!config) {
             return std::nullopt;
         }
         if (auto session = config->user->session_for_on_disk_path(m_realm->config().path)) {
-            return sync_session(std::move(session));
+            return sync_session(std::move(session), scheduler());
         }
         return std::nullopt;
     }
@@ -1,6 +1,7 @@
 #ifndef CPP_REALM_BRIDGE_REALM_HPP
 #define CPP_REALM_BRIDGE_REALM_HPP
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
@@ -177,6 +178,34 @@ namespace realm::internal::bridge {
             std::shared_ptr<SyncConfig> m_config;
         };
 
+        // The space used by a realm file and the versions it retains.
+        struct file_stats {
+            struct table_stats {
+                // The object type name.
+                std::string name;
+                size_t object_count = 0;
+                // An estimate of the bytes taken by the table's objects, excluding its history.
+                // Only read when table sizes are requested.
+                size_t size = 0;
+            };
+
+            // The size of the file on disk.
+            uint64_t file_size = 0;
+            // Bytes in use by the versions still retained, and bytes available for reuse.
+            uint64_t used_size = 0;
+            uint64_t free_size = 0;
+            // The number of versions retained, and the version of the latest commit.
+            uint64_t version_count = 0;
+            uint64_t latest_version = 0;
+            // The oldest retained version, which keeps the space freed by every later commit
+            // from being reused until it is released.
+            uint64_t oldest_version = 0;
+            // How long the oldest version has been retained for, measured from the first call
+            // to `get_file_stats()` which observed it in this process.
+            std::chrono::milliseconds oldest_version_age{0};
+            std::vector<table_stats> tables;
+        };
+
         realm();
         realm(const config&); //NOLINT(google-explicit-constructor)
         realm(std::shared_ptr<Realm>); //NOLINT(google-explicit-constructor)
@@ -187,11 +216,22 @@ namespace realm::internal::bridge {
         [[nodiscard]] struct schema schema() const;
         void begin_transaction() const;
         void commit_transaction() const;
+        [[nodiscard]] bool is_in_transaction() const;
+        [[nodiscard]] const std::string& path() const;
+        // The number of versions the file retains, which grows while old versions are pinned
+        // by frozen realms, unreleased objects or long-running reads.
+        [[nodiscard]] uint64_t get_number_of_versions() const;
+        // Sizes are read from the file's allocator, which takes time proportional to the
+        // number of free blocks; table sizes take time proportional to the tables' size.
+        [[nodiscard]] file_stats get_file_stats(bool table_sizes = false) const;
         table table_for_object_type(const std::string& object_type);
         table get_table(const uint32_t &);
         [[nodiscard]] std::shared_ptr<struct scheduler> scheduler() const;
         static async_open_task get_synchronized_realm(const config&);
         bool refresh();
+        // An immutable snapshot of the current version which may be read from any thread.
+        [[nodiscard]] realm freeze() const;
+        [[nodiscard]] bool is_frozen() const;
         [[nodiscard]] std::optional<sync_session> get_sync_session() const;
     private:
         std::shared_ptr<Realm> m_realm;
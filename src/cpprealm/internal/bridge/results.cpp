@@ -1,12 +1,40 @@
 #include <cpprealm/internal/bridge/results.hpp>
 
+#include <cpprealm/instrumentation.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
+#include <cpprealm/internal/bridge/object.hpp>
 #include <cpprealm/internal/bridge/query.hpp>
 #include <cpprealm/internal/bridge/realm.hpp>
 #include <cpprealm/internal/bridge/table.hpp>
+#include <cpprealm/tracing.hpp>
 #include <realm/object-store/results.hpp>
+#include <realm/object-store/shared_realm.hpp>
 
 namespace realm::internal::bridge {
+    namespace {
+        // Runs `fn`, recording it as a query execution if the results are still backed by a
+        // query: `size()` then runs a count over the query on every call, and `get()` evaluates
+        // it into a table view, after which later accesses are no longer counted.
+        template <typename Fn>
+        auto evaluate(Results& r, Fn&& fn) {
+            if (r.get_mode() != Results::Mode::Query) {
+                return fn();
+            }
+            CPPREALM_TRACE_SCOPE("db", "query");
+            auto realm = r.get_realm();
+            auto metrics = realm ? realm_metrics::find(realm->config().path) : nullptr;
+            if (!metrics) {
+                return fn();
+            }
+            auto start = std::chrono::steady_clock::now();
+            auto result = fn();
+            metrics->query_duration.record(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+            metrics->query_executions.fetch_add(1, std::memory_order_relaxed);
+            return result;
+        }
+    }
+
     results::results() {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         new (&m_results) Results();
@@ -77,10 +105,11 @@ namespace realm::internal::bridge {
 
     size_t results::size() {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
-        return reinterpret_cast<Results*>(&m_results)->size();
+        auto& r = *reinterpret_cast<Results*>(&m_results);
 #else
-        return m_results->size();
+        auto& r = *m_results;
 #endif
+        return evaluate(r, [&r] { return r.size(); });
     }
 
     realm results::get_realm() const {
@@ -102,13 +131,20 @@ namespace realm::internal::bridge {
     template <>
     obj get(results& res, size_t v) {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
-        return reinterpret_cast<Results*>(&res.m_results)->get(v);
+        auto& r = *reinterpret_cast<Results*>(&res.m_results);
 #else
-        return res.m_results->get(v);
+        auto& r = *res.m_results;
 #endif
+        return evaluate(r, [&r, v] { return obj(r.get(v)); });
     }
 
     notification_token results::add_notification_callback(std::shared_ptr<collection_change_callback> &&cb) {
+        return add_notification_callback(std::move(cb), key_path_array());
+    }
+
+    notification_token results::add_notification_callback(std::shared_ptr<collection_change_callback> &&cb,
+                                                          const key_path_array& key_paths) {
+        cb = internal::instrument_notification_callback(std::move(cb), static_cast<std::shared_ptr<Realm>>(get_realm()));
         struct wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
             explicit wrapper(std::shared_ptr<collection_change_callback>&& cb)
@@ -117,13 +153,14 @@ namespace realm::internal::bridge {
                 m_cb->before(v);
             }
             void after(const CollectionChangeSet& v) const {
+                CPPREALM_TRACE_SCOPE("notifications", "notify");
                 m_cb->after(v);
             }
         } ccb(std::move(cb));
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
-        return reinterpret_cast<Results*>(&m_results)->add_notification_callback(ccb);
+        return reinterpret_cast<Results*>(&m_results)->add_notification_callback(ccb, to_core_key_path_array(key_paths));
 #else
-        return m_results->add_notification_callback(ccb);
+        return m_results->add_notification_callback(ccb, to_core_key_path_array(key_paths));
 #endif
     }
 
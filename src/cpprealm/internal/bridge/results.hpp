@@ -31,6 +31,8 @@ namespace realm::internal::bridge {
         [[nodiscard]] table get_table() const;
         results(const realm&, const query&);
         notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&&);
+        notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&&,
+                                                     const key_path_array&);
     private:
         template <typename T>
         friend T get(results&, size_t);
@@ -1,12 +1,15 @@
 #include <cpprealm/internal/bridge/set.hpp>
 
+#include <cpprealm/instrumentation.hpp>
 #include <cpprealm/internal/bridge/col_key.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/realm.hpp>
 
 #include <cpprealm/internal/bridge/table.hpp>
+#include <cpprealm/tracing.hpp>
 #include <realm/object-store/set.hpp>
+#include <realm/object-store/shared_realm.hpp>
 
 #include <realm/array_mixed.hpp>
 #include <realm/array_typed_link.hpp>
@@ -172,7 +175,19 @@ namespace realm::internal::bridge {
     size_t set::find(const binary& v) { return get_set()->find(v.operator BinaryData()); }
     size_t set::find(const obj_key& v) { return get_set()->find(v.operator ObjKey()); }
 
+    bool set::is_subset_of(const set& rhs) const { return get_set()->is_subset_of(*rhs.get_set()); }
+    bool set::is_strict_subset_of(const set& rhs) const { return get_set()->is_strict_subset_of(*rhs.get_set()); }
+    bool set::is_superset_of(const set& rhs) const { return get_set()->is_superset_of(*rhs.get_set()); }
+    bool set::is_strict_superset_of(const set& rhs) const { return get_set()->is_strict_superset_of(*rhs.get_set()); }
+    bool set::intersects(const set& rhs) const { return get_set()->intersects(*rhs.get_set()); }
+    bool set::set_equals(const set& rhs) const { return get_set()->set_equals(*rhs.get_set()); }
+    void set::assign_intersection(const set& rhs) { get_set()->assign_intersection(*rhs.get_set()); }
+    void set::assign_union(const set& rhs) { get_set()->assign_union(*rhs.get_set()); }
+    void set::assign_difference(const set& rhs) { get_set()->assign_difference(*rhs.get_set()); }
+    void set::assign_symmetric_difference(const set& rhs) { get_set()->assign_symmetric_difference(*rhs.get_set()); }
+
     notification_token set::add_notification_callback(std::shared_ptr<collection_change_callback> cb) {
+        cb = internal::instrument_notification_callback(std::move(cb), get_set()->get_realm());
         struct wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
             explicit wrapper(std::shared_ptr<collection_change_callback>&& cb)
@@ -181,6 +196,7 @@ namespace realm::internal::bridge {
                 m_cb->before(v);
             }
             void after(const CollectionChangeSet& v) const {
+                CPPREALM_TRACE_SCOPE("notifications", "notify");
                 m_cb->after(v);
             }
         } ccb(std::move(cb));
@@ -1,11 +1,64 @@
 #include <cpprealm/internal/bridge/sync_session.hpp>
 #include <cpprealm/internal/bridge/status.hpp>
 
+#include <cpprealm/scheduler.hpp>
+
 #include <realm/object-store/sync/sync_session.hpp>
 
+#include <chrono>
 #include <future>
+#include <mutex>
 
 namespace realm::internal::bridge {
+    // Keeps the transfer counters of a session for which throughput was requested, and
+    // unregisters the progress notifiers feeding them when released.
+    struct sync_session::throughput_tracker {
+        struct direction {
+            uint64_t last_transferred = 0;
+            bool started = false;
+            uint64_t total = 0;
+            double bytes_per_second = 0;
+            std::chrono::steady_clock::time_point last_report;
+
+            void report(uint64_t transferred) {
+                auto now = std::chrono::steady_clock::now();
+                if (started && transferred > last_transferred) {
+                    auto delta = transferred - last_transferred;
+                    total += delta;
+                    std::chrono::duration<double> elapsed = now - last_report;
+                    if (elapsed.count() > 0) {
+                        // Smooth the rate so a single burst does not dominate it.
+                        constexpr double alpha = 0.2;
+                        auto rate = static_cast<double>(delta) / elapsed.count();
+                        bytes_per_second = bytes_per_second == 0 ? rate : alpha * rate + (1 - alpha) * bytes_per_second;
+                    }
+                }
+                started = true;
+                last_transferred = transferred;
+                last_report = now;
+            }
+        };
+
+        ~throughput_tracker() {
+            if (auto s = session.lock()) {
+                s->unregister_progress_notifier(upload_token);
+                s->unregister_progress_notifier(download_token);
+            }
+        }
+
+        std::mutex mutex;
+        direction upload;
+        direction download;
+        std::weak_ptr<SyncSession> session;
+        uint64_t upload_token = 0;
+        uint64_t download_token = 0;
+    };
+
+    namespace {
+        double progress_estimate(uint64_t transferred, uint64_t transferable) {
+            return transferable == 0 ? 1.0 : std::min(1.0, static_cast<double>(transferred) / static_cast<double>(transferable));
+        }
+    }
 
     enum sync_session::state sync_session::state() const {
         if (auto session = m_session.lock()) {
@@ -14,6 +67,30 @@ namespace realm::internal::bridge {
         throw std::runtime_error("Realm: Error accessing sync_session which has been destroyed.");
     }
 
+    void sync_session::pause() {
+        if (auto session = m_session.lock()) {
+            session->pause();
+        } else {
+            throw std::runtime_error("Realm: Error accessing sync_session which has been destroyed.");
+        }
+    }
+
+    void sync_session::resume() {
+        if (auto session = m_session.lock()) {
+            session->resume();
+        } else {
+            throw std::runtime_error("Realm: Error accessing sync_session which has been destroyed.");
+        }
+    }
+
+    void sync_session::reconnect() {
+        if (auto session = m_session.lock()) {
+            session->handle_reconnect();
+        } else {
+            throw std::runtime_error("Realm: Error accessing sync_session which has been destroyed.");
+        }
+    }
+
     void sync_session::wait_for_download_completion(std::function<void(status)> &&callback) {
         if (auto session = m_session.lock()) {
             session->wait_for_download_completion([cb = std::move(callback)](::realm::Status s) {
@@ -72,7 +149,68 @@ namespace realm::internal::bridge {
         return f;
     }
 
-    sync_session::sync_session(const std::shared_ptr<SyncSession> &v) {
+    sync_session::sync_session(const std::shared_ptr<SyncSession> &v, std::shared_ptr<struct scheduler> scheduler)
+        : m_scheduler(std::move(scheduler)) {
         m_session = v;
     }
+
+    uint64_t sync_session::register_progress_notifier(progress_direction direction, progress_mode mode,
+                                                      std::function<void(const progress&)>&& callback) {
+        auto session = m_session.lock();
+        if (!session) {
+            throw std::runtime_error("Realm: Error accessing sync_session which has been destroyed.");
+        }
+        auto cb = std::make_shared<std::function<void(const progress&)>>(std::move(callback));
+        // Newer sync clients pass their own estimate as a third argument; the estimate is
+        // derived from the byte counts here so every version reports the same thing.
+        auto notifier = [cb, scheduler = m_scheduler](uint64_t transferred, uint64_t transferable, auto&&...) {
+            progress p{transferred, transferable, progress_estimate(transferred, transferable)};
+            if (scheduler) {
+                scheduler->invoke([cb, p] {
+                    (*cb)(p);
+                });
+            } else {
+                (*cb)(p);
+            }
+        };
+        return session->register_progress_notifier(std::move(notifier),
+                                                   direction == progress_direction::upload ? SyncSession::ProgressDirection::upload
+                                                                                           : SyncSession::ProgressDirection::download,
+                                                   mode == progress_mode::streaming);
+    }
+
+    void sync_session::unregister_progress_notifier(uint64_t token) {
+        if (auto session = m_session.lock()) {
+            session->unregister_progress_notifier(token);
+        }
+    }
+
+    sync_session::throughput sync_session::get_throughput() {
+        auto session = m_session.lock();
+        if (!session) {
+            throw std::runtime_error("Realm: Error accessing sync_session which has been destroyed.");
+        }
+        if (!m_throughput) {
+            auto tracker = std::make_shared<throughput_tracker>();
+            tracker->session = session;
+            // The notifiers hold the tracker weakly, so that releasing it unregisters them.
+            std::weak_ptr<throughput_tracker> weak = tracker;
+            tracker->upload_token = session->register_progress_notifier([weak](uint64_t transferred, uint64_t, auto&&...) {
+                if (auto t = weak.lock()) {
+                    std::lock_guard lock(t->mutex);
+                    t->upload.report(transferred);
+                }
+            }, SyncSession::ProgressDirection::upload, true);
+            tracker->download_token = session->register_progress_notifier([weak](uint64_t transferred, uint64_t, auto&&...) {
+                if (auto t = weak.lock()) {
+                    std::lock_guard lock(t->mutex);
+                    t->download.report(transferred);
+                }
+            }, SyncSession::ProgressDirection::download, true);
+            m_throughput = std::move(tracker);
+        }
+        std::lock_guard lock(m_throughput->mutex);
+        return {m_throughput->upload.total, m_throughput->download.total,
+                m_throughput->upload.bytes_per_second, m_throughput->download.bytes_per_second};
+    }
 }
\ No newline at end of file
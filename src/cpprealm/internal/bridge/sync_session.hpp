@@ -1,6 +1,7 @@
 #ifndef CPP_REALM_BRIDGE_SYNC_SESSION_HPP
 #define CPP_REALM_BRIDGE_SYNC_SESSION_HPP
 
+#include <cstdint>
 #include <memory>
 #include <functional>
 #include <future>
@@ -8,6 +9,7 @@
 
 namespace realm {
     class SyncSession;
+    struct scheduler;
     namespace internal::bridge {
         struct status;
 
@@ -17,10 +19,66 @@ namespace realm {
                 dying,
                 inactive,
                 waiting_for_access_token,
+                paused,
             };
 
-            sync_session(const std::shared_ptr<SyncSession> &);
+            enum class progress_direction {
+                upload,
+                download
+            };
+
+            enum class progress_mode {
+                // Reports progress until the changes pending at registration have been
+                // transferred, then stops.
+                current_changes,
+                // Reports progress for as long as the notifier is registered.
+                streaming
+            };
+
+            struct progress {
+                uint64_t transferred_bytes = 0;
+                uint64_t transferable_bytes = 0;
+                // The fraction of transferable bytes transferred, in [0, 1].
+                double estimate = 0;
+
+                [[nodiscard]] bool is_complete() const {
+                    return transferred_bytes >= transferable_bytes;
+                }
+            };
+
+            // Bytes transferred by a session since its throughput was first requested, and the
+            // recent transfer rate in bytes per second.
+            struct throughput {
+                uint64_t uploaded_bytes = 0;
+                uint64_t downloaded_bytes = 0;
+                double upload_bytes_per_second = 0;
+                double download_bytes_per_second = 0;
+            };
+
+            sync_session(const std::shared_ptr<SyncSession> &, std::shared_ptr<struct scheduler> scheduler = nullptr);
             enum state state() const;
+
+            // Stops synchronization until `resume` is called, e.g. for the duration of a burst of
+            // local writes. Local writes are uploaded once the session is resumed.
+            void pause();
+            // Resumes a session stopped with `pause`.
+            void resume();
+            // Tells the sync client to retry connecting immediately instead of waiting for its
+            // backoff, e.g. when the device's network has come back.
+            void reconnect();
+
+            // Register a callback that will be called with the upload or download progress of
+            // this session. The callback is delivered on the scheduler of the realm this session
+            // was obtained from, or on the sync client's thread if there is none.
+            // Returns a token for `unregister_progress_notifier`.
+            uint64_t register_progress_notifier(progress_direction direction, progress_mode mode,
+                                                std::function<void(const progress&)>&& callback);
+            void unregister_progress_notifier(uint64_t token);
+
+            // The transfer counters of this session. Tracking starts on the first call, so the
+            // first call returns zeros, and is shared by copies of this object; it stops when
+            // the last of them is destroyed.
+            throughput get_throughput();
             // Register a callback that will be called when all pending uploads have completed.
             // The callback is run asynchronously, and upon whatever thread the underlying sync client
             // chooses to run it on.
@@ -36,7 +94,11 @@ namespace realm {
             // Register a callback that will be called when all pending downloads have been completed.
             std::future<void> wait_for_download_completion();
         private:
+            struct throughput_tracker;
+
             std::weak_ptr<SyncSession> m_session;
+            std::shared_ptr<struct scheduler> m_scheduler;
+            std::shared_ptr<throughput_tracker> m_throughput;
         };
     }
 }
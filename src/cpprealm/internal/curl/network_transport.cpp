@@ -18,10 +18,27 @@
 
 #include <cpprealm/app.hpp>
 #include <cpprealm/internal/generic_network_transport.hpp>
+#include <cpprealm/tracing.hpp>
 #include <curl/curl.h>
+#include <strings.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace realm::internal {
 
+    struct transport_counters {
+        static auto& get() {
+            return DefaultTransport::s_counters;
+        }
+    };
+
     namespace {
 
         class CurlGlobalGuard {
@@ -55,17 +72,137 @@ namespace realm::internal {
         std::mutex CurlGlobalGuard::m_mutex = {};
         int CurlGlobalGuard::m_users = 0;
 
-        static size_t curl_write_cb(char* ptr, size_t size, size_t nmemb, std::string* response)
+        // Keeps curl initialised for the lifetime of the process, and shares the connection
+        // cache, DNS cache and TLS sessions between all requests so that consecutive calls to
+        // the same host skip the TCP and TLS handshakes.
+        class CurlConnectionPool {
+        public:
+            static CurlConnectionPool& shared()
+            {
+                static CurlConnectionPool pool;
+                return pool;
+            }
+
+            CURL* acquire()
+            {
+                {
+                    std::lock_guard<std::mutex> lk(m_handles_mutex);
+                    if (!m_handles.empty()) {
+                        auto curl = m_handles.back();
+                        m_handles.pop_back();
+                        return curl;
+                    }
+                }
+                auto curl = curl_easy_init();
+                if (curl) {
+                    transport_counters::get().handles_created.fetch_add(1, std::memory_order_relaxed);
+                }
+                return curl;
+            }
+
+            void release(CURL* curl)
+            {
+                // Resetting keeps the handle's connection and DNS caches, only options are cleared.
+                curl_easy_reset(curl);
+                std::lock_guard<std::mutex> lk(m_handles_mutex);
+                if (m_handles.size() < max_idle_handles) {
+                    m_handles.push_back(curl);
+                    return;
+                }
+                curl_easy_cleanup(curl);
+            }
+
+            // Applies the options every pooled request needs after `curl_easy_reset`.
+            void configure(CURL* curl)
+            {
+                curl_easy_setopt(curl, CURLOPT_SHARE, m_share);
+                curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+                curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, dns_cache_timeout_s);
+                // An empty string advertises every encoding this libcurl was built with
+                // (gzip and deflate, and br or zstd when available) and decodes the
+                // response transparently.
+                curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
+            }
+
+            ~CurlConnectionPool()
+            {
+                for (auto curl : m_handles) {
+                    curl_easy_cleanup(curl);
+                }
+                curl_share_cleanup(m_share);
+            }
+
+        private:
+            static constexpr size_t max_idle_handles = 16;
+            static constexpr long dns_cache_timeout_s = 300;
+
+            CurlConnectionPool()
+            {
+                m_share = curl_share_init();
+                curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+                curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+                curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+                curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+                curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, lock_cb);
+                curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, unlock_cb);
+            }
+
+            static void lock_cb(CURL*, curl_lock_data data, curl_lock_access, void* userptr)
+            {
+                static_cast<CurlConnectionPool*>(userptr)->m_share_mutexes[data % CURL_LOCK_DATA_LAST].lock();
+            }
+
+            static void unlock_cb(CURL*, curl_lock_data data, void* userptr)
+            {
+                static_cast<CurlConnectionPool*>(userptr)->m_share_mutexes[data % CURL_LOCK_DATA_LAST].unlock();
+            }
+
+            CurlGlobalGuard m_global_guard;
+            CURLSH* m_share = nullptr;
+            std::array<std::mutex, CURL_LOCK_DATA_LAST> m_share_mutexes;
+            std::mutex m_handles_mutex;
+            std::vector<CURL*> m_handles;
+        };
+
+        // Caps how much a Content-Length header may pre-allocate.
+        static constexpr size_t max_body_reserve = 64 * 1024 * 1024;
+
+        // The state of one transfer. It must outlive the transfer, as curl keeps pointers
+        // into the request and writes into the response buffers.
+        struct CurlTransfer {
+            explicit CurlTransfer(app::Request&& r, util::UniqueFunction<void(const app::Response&)>&& c = {})
+                : request(std::move(r)), completion(std::move(c)) {}
+            ~CurlTransfer()
+            {
+                curl_slist_free_all(header_list);
+            }
+            CurlTransfer(const CurlTransfer&) = delete;
+            CurlTransfer& operator=(const CurlTransfer&) = delete;
+
+            app::Request request;
+            util::UniqueFunction<void(const app::Response&)> completion;
+            std::string response;
+            app::HttpHeaders response_headers;
+            curl_slist* header_list = nullptr;
+#ifdef CPPREALM_ENABLE_TRACING
+            // Ended by `finish_transfer`, on the thread which completes the transfer.
+            tracing::span span{"transport", "http_request"};
+#endif
+        };
+
+        // Receives the body after content decoding, so compressed responses are inflated
+        // chunk by chunk straight into the buffer handed to the object store.
+        static size_t curl_write_cb(char* ptr, size_t size, size_t nmemb, CurlTransfer* transfer)
         {
-            REALM_ASSERT(response);
+            REALM_ASSERT(transfer);
             size_t realsize = size * nmemb;
-            response->append(ptr, realsize);
+            transfer->response.append(ptr, realsize);
             return realsize;
         }
 
-        static size_t curl_header_cb(char* buffer, size_t size, size_t nitems, std::map<std::string, std::string>* response_headers)
+        static size_t curl_header_cb(char* buffer, size_t size, size_t nitems, CurlTransfer* transfer)
         {
-            REALM_ASSERT(response_headers);
+            REALM_ASSERT(transfer);
             std::string combined(buffer, size * nitems);
             if (auto pos = combined.find(':'); pos != std::string::npos) {
                 std::string key = combined.substr(0, pos);
@@ -76,7 +213,13 @@ namespace realm::internal {
                 while (value.size() > 0 && (value[value.size() - 1] == '\r' || value[value.size() - 1] == '\n')) {
                     value = value.substr(0, value.size() - 1);
                 }
-                response_headers->insert({key, value});
+                // The decoded body is at least as large as the transferred one, so size the
+                // buffer up front rather than growing it chunk by chunk.
+                if (strcasecmp(key.c_str(), "Content-Length") == 0) {
+                    transfer->response.reserve(std::min<size_t>(std::strtoull(value.c_str(), nullptr, 10),
+                                                                max_body_reserve));
+                }
+                transfer->response_headers.insert({key, value});
             }
             else {
                 if (combined.size() > 5 && combined.substr(0, 5) != "HTTP/") { // ignore for now HTTP/1.1 ...
@@ -86,18 +229,10 @@ namespace realm::internal {
             return nitems * size;
         }
 
-        static app::Response do_http_request(const app::Request& request)
+        static void prepare_transfer(CURL* curl, CurlTransfer& transfer)
         {
-            CurlGlobalGuard curl_global_guard;
-            auto curl = curl_easy_init();
-            if (!curl) {
-                return app::Response{500, -1};
-            }
-
-            struct curl_slist* list = nullptr;
-
-            std::string response;
-            app::HttpHeaders response_headers;
+            auto& request = transfer.request;
+            CurlConnectionPool::shared().configure(curl);
 
             /* First set the URL that is about to receive our POST. This URL can
      just as well be a https:// URL if that is what should receive the
@@ -120,51 +255,222 @@ namespace realm::internal {
                 curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "DELETE");
                 curl_easy_setopt(curl, CURLOPT_POSTFIELDS, request.body.c_str());
             }
-            else if (request.method == app::HttpMethod::patch) {
-                curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "PATCH");
-                curl_easy_setopt(curl, CURLOPT_POSTFIELDS, request.body.c_str());
-            }
 
-            curl_easy_setopt(curl, CURLOPT_TIMEOUT, request.timeout_ms);
+            curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, static_cast<long>(request.timeout_ms));
 
             for (auto header : request.headers) {
                 auto header_str = util::format("%1: %2", header.first, header.second);
-                list = curl_slist_append(list, header_str.c_str());
+                transfer.header_list = curl_slist_append(transfer.header_list, header_str.c_str());
             }
-            curl_easy_setopt(curl, CURLOPT_HTTPHEADER, list);
+            curl_easy_setopt(curl, CURLOPT_HTTPHEADER, transfer.header_list);
             curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, curl_write_cb);
-            curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+            curl_easy_setopt(curl, CURLOPT_WRITEDATA, &transfer);
             curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, curl_header_cb);
-            curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response_headers);
+            curl_easy_setopt(curl, CURLOPT_HEADERDATA, &transfer);
+        }
 
-            auto response_code = curl_easy_perform(curl);
-            if (response_code != CURLE_OK) {
-                fprintf(stderr, "curl_easy_perform() failed when sending request to '%s' with body '%s': %s\n",
-                        request.url.c_str(), request.body.c_str(), curl_easy_strerror(response_code));
+        static app::Response finish_transfer(CURL* curl, CurlTransfer& transfer, CURLcode result)
+        {
+#ifdef CPPREALM_ENABLE_TRACING
+            transfer.span.end();
+#endif
+            if (result != CURLE_OK) {
+                fprintf(stderr, "curl request failed when sending request to '%s' with body '%s': %s\n",
+                        transfer.request.url.c_str(), transfer.request.body.c_str(), curl_easy_strerror(result));
             }
             long http_code = 0;
             curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
-            curl_easy_cleanup(curl);
-            curl_slist_free_all(list);
+            long new_connections = 0;
+            curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &new_connections);
+            transport_counters::get().requests.fetch_add(1, std::memory_order_relaxed);
+            if (result == CURLE_OK) {
+                auto& counter = new_connections > 0 ? transport_counters::get().connections_opened
+                                                    : transport_counters::get().connections_reused;
+                counter.fetch_add(1, std::memory_order_relaxed);
+            }
             return {
                     static_cast<int>(http_code),
                     0, // binding_response_code
-                    std::move(response_headers),
-                    std::move(response),
+                    std::move(transfer.response_headers),
+                    std::move(transfer.response),
             };
         }
+
+        static app::Response do_http_request(app::Request&& request)
+        {
+            auto& pool = CurlConnectionPool::shared();
+            auto curl = pool.acquire();
+            if (!curl) {
+                return app::Response{500, -1};
+            }
+            CurlTransfer transfer(std::move(request));
+            prepare_transfer(curl, transfer);
+            auto result = curl_easy_perform(curl);
+            auto response = finish_transfer(curl, transfer, result);
+            pool.release(curl);
+            return response;
+        }
     } // namespace
 
     void DefaultTransport::send_request_to_server(const app::Request& request,
                                                   util::UniqueFunction<void(const app::Response&)>&& completion_block)
     {
+        auto req_copy = request;
+        if (m_custom_http_headers) {
+            req_copy.headers.insert(m_custom_http_headers->begin(), m_custom_http_headers->end());
+        }
+        completion_block(do_http_request(std::move(req_copy)));
+    }
+
+    // The I/O thread holds its own reference to this state, so that a completion handler may
+    // release the last reference to the transport.
+    struct CurlMultiTransport::impl : std::enable_shared_from_this<CurlMultiTransport::impl> {
+        explicit impl(size_t max_connections_per_host)
+        {
+            m_multi = curl_multi_init();
+            curl_multi_setopt(m_multi, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(max_connections_per_host));
+            // Multiplex concurrent requests over one connection when the server speaks HTTP/2.
+            curl_multi_setopt(m_multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        }
+
+        ~impl()
+        {
+            curl_multi_cleanup(m_multi);
+        }
+
+        void start()
+        {
+            m_thread = std::thread([self = shared_from_this()] {
+                self->run();
+            });
+        }
+
+        void stop()
+        {
+            {
+                std::lock_guard<std::mutex> lk(m_mutex);
+                m_stopped = true;
+            }
+            curl_multi_wakeup(m_multi);
+            if (m_thread.get_id() == std::this_thread::get_id()) {
+                // Called from a completion handler: joining would wait for this very call.
+                // The thread fails what is outstanding and exits once the handler returns.
+                m_thread.detach();
+            } else {
+                m_thread.join();
+            }
+        }
+
+        void submit(std::unique_ptr<CurlTransfer>&& transfer)
+        {
+            // Count the transfer before the I/O thread can see it, so that it cannot complete,
+            // and decrement, before it was counted.
+            m_in_flight.fetch_add(1, std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lk(m_mutex);
+                m_submitted.push_back(std::move(transfer));
+            }
+            curl_multi_wakeup(m_multi);
+        }
+
+        void run()
+        {
+            auto& pool = CurlConnectionPool::shared();
+            std::map<CURL*, std::unique_ptr<CurlTransfer>> active;
+            while (true) {
+                std::vector<std::unique_ptr<CurlTransfer>> submitted;
+                bool stopped;
+                {
+                    std::lock_guard<std::mutex> lk(m_mutex);
+                    submitted.swap(m_submitted);
+                    stopped = m_stopped;
+                }
+                for (auto& transfer : submitted) {
+                    auto curl = pool.acquire();
+                    if (!curl) {
+                        complete(*transfer, app::Response{500, -1});
+                        continue;
+                    }
+                    prepare_transfer(curl, *transfer);
+                    curl_easy_setopt(curl, CURLOPT_PRIVATE, transfer.get());
+                    // Prefer waiting for a multiplexable connection over opening another one.
+                    curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+                    curl_multi_add_handle(m_multi, curl);
+                    active.emplace(curl, std::move(transfer));
+                }
+                if (stopped) {
+                    break;
+                }
+
+                int running = 0;
+                curl_multi_perform(m_multi, &running);
+                int queued = 0;
+                while (auto msg = curl_multi_info_read(m_multi, &queued)) {
+                    if (msg->msg != CURLMSG_DONE) {
+                        continue;
+                    }
+                    auto curl = msg->easy_handle;
+                    auto result = msg->data.result;
+                    auto it = active.find(curl);
+                    curl_multi_remove_handle(m_multi, curl);
+                    auto response = finish_transfer(curl, *it->second, result);
+                    pool.release(curl);
+                    complete(*it->second, response);
+                    active.erase(it);
+                }
+                // Per-request timeouts are enforced by curl through CURLOPT_TIMEOUT_MS;
+                // curl_multi_poll wakes up in time for them or on curl_multi_wakeup.
+                curl_multi_poll(m_multi, nullptr, 0, 1000, nullptr);
+            }
+
+            // Fail whatever is still outstanding so no completion is lost.
+            for (auto& [curl, transfer] : active) {
+                curl_multi_remove_handle(m_multi, curl);
+                pool.release(curl);
+                complete(*transfer, app::Response{500, -1});
+            }
+        }
+
+        void complete(CurlTransfer& transfer, const app::Response& response)
+        {
+            m_in_flight.fetch_sub(1, std::memory_order_relaxed);
+            transfer.completion(response);
+        }
+
+        CURLM* m_multi = nullptr;
+        std::thread m_thread;
+        std::mutex m_mutex;
+        std::vector<std::unique_ptr<CurlTransfer>> m_submitted;
+        bool m_stopped = false;
+        std::atomic<size_t> m_in_flight = 0;
+    };
+
+    CurlMultiTransport::CurlMultiTransport(const std::optional<std::map<std::string, std::string>>& custom_http_headers,
+                                           size_t max_connections_per_host)
+        : m_custom_http_headers(custom_http_headers)
+        , m_impl(std::make_shared<impl>(max_connections_per_host))
+    {
+        m_impl->start();
+    }
+
+    CurlMultiTransport::~CurlMultiTransport()
+    {
+        m_impl->stop();
+    }
+
+    void CurlMultiTransport::send_request_to_server(const app::Request& request,
+                                                    util::UniqueFunction<void(const app::Response&)>&& completion_block)
+    {
+        auto req_copy = request;
         if (m_custom_http_headers) {
-            auto req_copy = request;
             req_copy.headers.insert(m_custom_http_headers->begin(), m_custom_http_headers->end());
-            completion_block(do_http_request(req_copy));
-            return;
         }
-        completion_block(do_http_request(request));
+        m_impl->submit(std::make_unique<CurlTransfer>(std::move(req_copy), std::move(completion_block)));
+    }
+
+    size_t CurlMultiTransport::in_flight() const
+    {
+        return m_impl->m_in_flight.load(std::memory_order_relaxed);
     }
 
 
@@ -20,19 +20,76 @@
 #define realm_cpp_generic_network_transport
 
 #include <realm/object-store/sync/generic_network_transport.hpp>
+#include <atomic>
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <optional>
 
 namespace realm::internal {
 
+// Process-wide counters for the default transport, to make connection reuse observable.
+struct transport_stats {
+    uint64_t requests = 0;
+    // Requests which had to open a new connection.
+    uint64_t connections_opened = 0;
+    // Requests served over an already open, kept-alive connection.
+    uint64_t connections_reused = 0;
+    // Native handles (e.g. CURL easy handles) created to serve requests.
+    uint64_t handles_created = 0;
+};
+
 class DefaultTransport : public app::GenericNetworkTransport {
 public:
     DefaultTransport(const std::optional<std::map<std::string, std::string>>& custom_http_headers = std::nullopt) : m_custom_http_headers(custom_http_headers) {}
     void send_request_to_server(const app::Request& request,
                                 util::UniqueFunction<void(const app::Response&)>&& completion);
+
+    static transport_stats stats() {
+        return {
+            s_counters.requests.load(std::memory_order_relaxed),
+            s_counters.connections_opened.load(std::memory_order_relaxed),
+            s_counters.connections_reused.load(std::memory_order_relaxed),
+            s_counters.handles_created.load(std::memory_order_relaxed),
+        };
+    }
+private:
+    // Updated by the platform transport implementations; read through `stats()`.
+    struct counters {
+        std::atomic<uint64_t> requests = 0;
+        std::atomic<uint64_t> connections_opened = 0;
+        std::atomic<uint64_t> connections_reused = 0;
+        std::atomic<uint64_t> handles_created = 0;
+    };
+    static inline counters s_counters;
+    // Lets transport helpers that are not members of this class update the counters.
+    friend struct transport_counters;
+
+    std::optional<std::map<std::string, std::string>> m_custom_http_headers;
+};
+
+#ifdef CPPREALM_HAVE_CURL
+// A transport which runs every request on a single curl multi handle driven by a dedicated
+// I/O thread, so any number of requests can be in flight without blocking the caller or
+// holding a thread each. Completions are called on the I/O thread and must not block it.
+// Requests still outstanding when the transport is destroyed complete with a 500 status
+// and a custom status code of -1. The transport may be destroyed from a completion handler.
+class CurlMultiTransport : public app::GenericNetworkTransport {
+public:
+    CurlMultiTransport(const std::optional<std::map<std::string, std::string>>& custom_http_headers = std::nullopt,
+                       size_t max_connections_per_host = 8);
+    ~CurlMultiTransport();
+    void send_request_to_server(const app::Request& request,
+                                util::UniqueFunction<void(const app::Response&)>&& completion) override;
+
+    // The number of requests submitted but not yet completed.
+    size_t in_flight() const;
 private:
+    struct impl;
     std::optional<std::map<std::string, std::string>> m_custom_http_headers;
+    std::shared_ptr<impl> m_impl;
 };
+#endif
 
 } // namespace realm
 
@@ -21,11 +21,26 @@
 #endif
 #include <cpprealm/app.hpp>
 #include <cpprealm/internal/generic_network_transport.hpp>
+#include <cpprealm/tracing.hpp>
 
 #include <realm/sync/network/http.hpp>
 #include <realm/sync/network/network.hpp>
 #include <realm/sync/noinst/client_impl_base.hpp>
 
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <poll.h>
+#include <sys/socket.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+
 namespace realm::internal {
     struct DefaultSocket : realm::sync::network::Socket {
         DefaultSocket(realm::sync::network::Service& service)
@@ -78,50 +93,245 @@ namespace realm::internal {
         realm::sync::network::ReadAheadBuffer m_read_buffer;
     };
 
-    void DefaultTransport::send_request_to_server(const app::Request& request,
-                                                  util::UniqueFunction<void(const app::Response&)>&& completion_block) {
-        // Get the host name.
-        size_t found = request.url.find_first_of(":");
-        std::string domain = request.url.substr(found+3);
-        size_t found1 = domain.find_first_of(":");
-        size_t found2 = domain.find_first_of("/");
-        const std::string host = domain.substr(found1 + 1, found2 - found1 - 1);
-
-        realm::sync::network::Service service;
-        realm::sync::network::Endpoint ep;
-
-        try {
-            auto resolver = realm::sync::network::Resolver{service};
-            auto resolved = resolver.resolve(sync::network::Resolver::Query(host, "443"));
-            ep = *resolved.begin();
-        } catch (...) {
-            app::Response response;
-            response.http_status_code = 500;
-            completion_block(std::move(response));
-            return;
+    namespace {
+        struct url_parts {
+            bool tls = true;
+            std::string host;
+            std::string port;
+
+            std::string key() const {
+                return util::format("%1://%2:%3", tls ? "https" : "http", host, port);
+            }
+        };
+
+        url_parts parse_url(const std::string& url) {
+            url_parts parts;
+            auto scheme_end = url.find("://");
+            size_t authority_start = 0;
+            if (scheme_end != std::string::npos) {
+                parts.tls = url.compare(0, scheme_end, "http") != 0;
+                authority_start = scheme_end + 3;
+            }
+            auto authority_end = url.find_first_of("/?#", authority_start);
+            auto authority = url.substr(authority_start, authority_end == std::string::npos ? std::string::npos
+                                                                                            : authority_end - authority_start);
+            auto port_start = authority.find(':');
+            parts.host = authority.substr(0, port_start);
+            parts.port = port_start != std::string::npos ? authority.substr(port_start + 1) : (parts.tls ? "443" : "80");
+            return parts;
         }
 
-        using namespace realm::sync::network::ssl;
-        Context m_ssl_context;
-        DefaultSocket socket{service};
-        socket.connect(ep);
+        // A connection to one host, with its own event loop so that requests on different
+        // connections can run concurrently on their callers' threads.
+        struct Connection {
+            explicit Connection(std::shared_ptr<util::Logger> logger)
+                : logger(std::move(logger))
+                , http_client(socket, this->logger)
+            {
+            }
+
+            realm::sync::network::Service service;
+            DefaultSocket socket{service};
+            std::shared_ptr<util::Logger> logger;
+            realm::sync::HTTPClient<DefaultSocket> http_client;
+            std::chrono::steady_clock::time_point idle_since;
+
+            // Whether the server has not closed the connection while it was idle. An idle
+            // connection has nothing to read unless the server sent its FIN or a reset, so a
+            // connection is only given up if peeking at it reports end of stream or an error.
+            bool is_open() {
+                auto fd = socket.native_handle();
+#ifdef _WIN32
+                WSAPOLLFD pfd{fd, POLLRDNORM, 0};
+                int ready = ::WSAPoll(&pfd, 1, 0);
+#else
+                pollfd pfd{fd, POLLIN, 0};
+                int ready = ::poll(&pfd, 1, 0);
+#endif
+                if (ready == 0) {
+                    return true;
+                }
+                if (ready < 0 || (pfd.revents & (POLLERR | POLLHUP | POLLNVAL))) {
+                    return false;
+                }
+                char c;
+                return ::recv(fd, &c, 1, MSG_PEEK) > 0;
+            }
+
+        // Process-wide state shared by all requests: one SSL context, a cache of resolved
+        // endpoints and the idle keep-alive connections of each host.
+        //
+        // A request on an idle connection skips name resolution, the TCP connect and the
+        // TLS handshake, leaving a single round-trip for the request itself. Connections
+        // whose TLS session is kept alive this way need no session resumption.
+        class ConnectionPool {
+        public:
+            static ConnectionPool& shared() {
+                static ConnectionPool pool;
+                return pool;
+            }
+
+            // Returns an idle connection to `url`'s host, or nullptr if there is none. Connections
+            // that expired or that the server closed while idle are dropped.
+            std::unique_ptr<Connection> acquire(const url_parts& url) {
+                std::lock_guard lock(m_mutex);
+                auto it = m_idle.find(url.key());
+                if (it == m_idle.end()) {
+                    return nullptr;
+                }
+                auto now = std::chrono::steady_clock::now();
+                auto& connections = it->second;
+                while (!connections.empty()) {
+                    auto connection = std::move(connections.back());
+                    connections.pop_back();
+                    if (now - connection->idle_since < s_idle_timeout && connection->is_open()) {
+                        return connection;
+                    }
+                }
+                return nullptr;
+            }
+
+            void release(const url_parts& url, std::unique_ptr<Connection>&& connection) {
+                connection->idle_since = std::chrono::steady_clock::now();
+                std::lock_guard lock(m_mutex);
+                auto& connections = m_idle[url.key()];
+                if (connections.size() < s_max_idle_per_host) {
+                    connections.push_back(std::move(connection));
+                }
+            }
 
+            // Opens a new connection to `url`'s host. The TLS handshake, if any, is left
+            // to the first request. Returns nullptr if the host cannot be reached.
+            std::unique_ptr<Connection> connect(const url_parts& url) {
+                auto connection = std::make_unique<Connection>(util::Logger::get_default_logger());
+                for (bool cached : {true, false}) {
+                    auto endpoints = resolve(connection->service, url, cached);
+                    for (auto& ep : endpoints) {
+                        std::error_code ec;
+                        connection->socket.connect(ep, ec);
+                        if (!ec) {
+                            if (url.tls) {
+                                using namespace realm::sync::network::ssl;
+                                auto& socket = connection->socket;
+                                socket.ssl_stream.emplace(socket, m_ssl_context, Stream::client);
+                                socket.ssl_stream->set_host_name(url.host); // Throws
+                                socket.ssl_stream->set_verify_mode(VerifyMode::peer);
+                                socket.ssl_stream->set_logger(connection->logger.get());
+                            }
+                            return connection;
+                        }
+                    }
+                    // The cached endpoints may be stale, so retry once with a fresh lookup.
+                    if (!cached) {
+                        break;
+                    }
+                    std::lock_guard lock(m_mutex);
+                    m_resolved.erase(url.key());
+                }
+                return nullptr;
+            }
+
+        private:
+            ConnectionPool() {
 #if REALM_INCLUDE_CERTS
-        m_ssl_context.use_included_certificate_roots();
+                m_ssl_context.use_included_certificate_roots();
 #endif
+            }
 
-        socket.ssl_stream.emplace(socket, m_ssl_context, Stream::client);
-        socket.ssl_stream->set_host_name(host); // Throws
+            std::vector<realm::sync::network::Endpoint> resolve(realm::sync::network::Service& service,
+                                                                const url_parts& url, bool use_cache) {
+                auto now = std::chrono::steady_clock::now();
+                if (use_cache) {
+                    std::lock_guard lock(m_mutex);
+                    auto it = m_resolved.find(url.key());
+                    if (it != m_resolved.end() && now < it->second.expires) {
+                        return it->second.endpoints;
+                    }
+                }
+                std::vector<realm::sync::network::Endpoint> endpoints;
+                try {
+                    realm::sync::network::Resolver resolver{service};
+                    auto resolved = resolver.resolve(realm::sync::network::Resolver::Query(url.host, url.port));
+                    endpoints.assign(resolved.begin(), resolved.end());
+                } catch (...) {
+                    return {};
+                }
+                std::lock_guard lock(m_mutex);
+                m_resolved[url.key()] = {endpoints, now + s_resolver_ttl};
+                return endpoints;
+            }
 
-        socket.ssl_stream->set_verify_mode(VerifyMode::peer);
-        auto logger = util::Logger::get_default_logger();
-        socket.ssl_stream->set_logger(logger.get());
+            struct resolved_endpoints {
+                std::vector<realm::sync::network::Endpoint> endpoints;
+                std::chrono::steady_clock::time_point expires;
+            };
+
+            static constexpr auto s_resolver_ttl = std::chrono::minutes(5);
+            static constexpr auto s_idle_timeout = std::chrono::seconds(60);
+            static constexpr size_t s_max_idle_per_host = 4;
+
+            std::mutex m_mutex;
+            realm::sync::network::ssl::Context m_ssl_context;
+            std::map<std::string, std::vector<std::unique_ptr<Connection>>> m_idle;
+            std::map<std::string, resolved_endpoints> m_resolved;
+        };
+
+        /*
+         * Flow of events:
+         * 1. Runloop is enqeued with task via service.post
+         * 2. SSL handshake is performed, unless the connection was reused
+         * 3. HTTP request is send over the wire
+         * 4. Response is read back, or an error is reported in `ec`
+         */
+        realm::sync::HTTPResponse perform_request(Connection& connection, bool handshake,
+                                                  realm::sync::HTTPRequest&& req, std::error_code& ec) {
+            realm::sync::HTTPResponse response;
+            auto send = [&] {
+                connection.http_client.async_request(std::move(req), [&](const realm::sync::HTTPResponse& r, const std::error_code& e) {
+                    response = r;
+                    ec = e;
+                });
+            };
+            connection.service.post([&](realm::Status&&) {
+                if (!handshake) {
+                    send();
+                    return;
+                }
+                connection.socket.async_handshake([&](std::error_code e) {
+                    if (e) {
+                        ec = e;
+                        return;
+                    }
+                    send();
+                }); // Throws
+            });
+            connection.service.run();
+            return response;
+        }
+
+        bool keep_alive(const realm::sync::HTTPResponse& response) {
+            auto it = response.headers.find("Connection");
+            if (it == response.headers.end()) {
+                return true;
+            }
+            std::string value = it->second;
+            std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
+                return static_cast<char>(std::tolower(c));
+            });
+            return value != "close";
+        }
+    }
+
+    void DefaultTransport::send_request_to_server(const app::Request& request,
+                                                  util::UniqueFunction<void(const app::Response&)>&& completion_block) {
+        CPPREALM_TRACE_SCOPE("transport", "http_request");
+        auto url = parse_url(request.url);
 
         realm::sync::HTTPHeaders headers;
         for (auto& [k, v] : request.headers) {
             headers[k] = v;
         }
-        headers["Host"] = host;
+        headers["Host"] = url.host;
         headers["User-Agent"] = "Realm C++ SDK";
 
         if (!request.body.empty()) {
@@ -134,7 +344,6 @@ namespace realm::internal {
             }
         }
 
-        realm::sync::HTTPClient<DefaultSocket> m_http_client = realm::sync::HTTPClient<DefaultSocket>(socket, logger);
         realm::sync::HTTPMethod method;
         switch (request.method) {
             case app::HttpMethod::get:
@@ -153,40 +362,57 @@ namespace realm::internal {
                 REALM_UNREACHABLE();
         }
 
-        /*
-         * Flow of events:
-         * 1. hostname is resolved from DNS
-         * 2. socket establishes connection with host
-         * 3. Runloop is enqeued with task via service.post
-         * 4. SSL handshake is performed
-         * 5. HTTP request is send over the wire
-         * 6. Response is converted to object store type and passed back to SDK
-         */
+        auto& pool = ConnectionPool::shared();
+        // Idle connections the server has closed are skipped when acquired, but the server
+        // may still close one just as the request is sent, in which case the request is
+        // retried once on a new connection. The HTTP client does not tell whether the server
+        // already received the request, so only idempotent methods are retried; a POST, e.g.
+        // a function call, must not run twice.
+        bool idempotent = method != realm::sync::HTTPMethod::Post;
+        for (int attempt = 0; attempt < 2; attempt++) {
+            auto connection = pool.acquire(url);
+            bool reused = connection != nullptr;
+            if (!reused) {
+                connection = pool.connect(url);
+                if (!connection) {
+                    break;
+                }
+            }
 
-        service.post([&](realm::Status&&){
-            auto handler = [&](std::error_code ec) {
-                if (ec.value() == 0) {
-                    realm::sync::HTTPRequest req;
-                    req.method = method;
-                    req.headers = headers;
-                    req.path = request.url;
-                    req.body = request.body.empty() ? std::nullopt : std::optional<std::string>(request.body);
-
-                    m_http_client.async_request(std::move(req), [cb = std::move(completion_block)](const realm::sync::HTTPResponse& r, const std::error_code& e) {
-                        app::Response res;
-                        res.body = r.body ? *r.body : "";
-                        for (auto& [k, v] : r.headers)  {
-                            res.headers[k] = v;
-                        }
-                        res.http_status_code = static_cast<int>(r.status);
-                        res.custom_status_code = 0;
-                        cb(res);
-                    });
+            realm::sync::HTTPRequest req;
+            req.method = method;
+            req.headers = headers;
+            req.path = request.url;
+            req.body = request.body.empty() ? std::nullopt : std::optional<std::string>(request.body);
+
+            std::error_code ec;
+            auto r = perform_request(*connection, !reused && url.tls, std::move(req), ec);
+            if (ec) {
+                if (reused && idempotent) {
+                    continue;
                 }
-            };
-            socket.async_handshake(std::move(handler)); // Throws
-        });
+                break;
+            }
+
+            s_counters.requests.fetch_add(1, std::memory_order_relaxed);
+            (reused ? s_counters.connections_reused : s_counters.connections_opened).fetch_add(1, std::memory_order_relaxed);
+            if (keep_alive(r)) {
+                pool.release(url, std::move(connection));
+            }
+
+            app::Response res;
+            res.body = r.body ? *r.body : "";
+            for (auto& [k, v] : r.headers)  {
+                res.headers[k] = v;
+            }
+            res.http_status_code = static_cast<int>(r.status);
+            res.custom_status_code = 0;
+            completion_block(res);
+            return;
+        }
 
-        service.run();
+        app::Response response;
+        response.http_status_code = 500;
+        completion_block(std::move(response));
     }
-}
\ No newline at end of file
+}
@@ -4,6 +4,12 @@
 
 #include <cpprealm/logger.hpp>
 #include <realm/util/logger.hpp>
+#include <realm/version_numbers.hpp>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
 
 namespace realm {
     static_assert((int)util::Logger::Level::off == (int)logger::level::off);
@@ -63,15 +69,117 @@ namespace realm {
         abort();
     }
 
+    namespace {
+        // An immutable set of thresholds. Writers publish a new snapshot, so that messages
+        // can be filtered without taking a lock.
+        struct level_snapshot {
+            logger::level default_level = logger::level::info;
+            // Until a category threshold is set, messages are only filtered by the thresholds
+            // of the database and sync manager loggers, as before categories existed.
+            std::map<std::string, logger::level, std::less<>> levels;
+        };
+
+        struct category_levels {
+            // Serializes writers.
+            std::mutex mutex;
+            std::shared_ptr<const level_snapshot> current = std::make_shared<level_snapshot>();
+        };
+
+        category_levels& levels() {
+            static category_levels l;
+            return l;
+        }
+
+        std::shared_ptr<const level_snapshot> current_levels() {
+            return std::atomic_load(&levels().current);
+        }
+
+        // The threshold of the closest configured ancestor of `category`, or the default.
+        logger::level level_for(const level_snapshot& l, std::string_view category) {
+            while (true) {
+                if (auto it = l.levels.find(category); it != l.levels.end()) {
+                    return it->second;
+                }
+                auto dot = category.rfind('.');
+                if (dot == std::string_view::npos) {
+                    return l.default_level;
+                }
+                category = category.substr(0, dot);
+            }
+        }
+
+        // The database only checks a single threshold before formatting a message, so it
+        // is set to the most verbose level of any category and the messages of quieter
+        // categories are discarded in `internal_logger`.
+        void update_core_threshold(const level_snapshot& l) {
+            auto most_verbose = l.default_level;
+            for (auto& [category, level] : l.levels) {
+                most_verbose = std::min(most_verbose, level);
+            }
+            util::Logger::set_default_level_threshold(log_level_for_level(most_verbose));
+        }
+
+        // Applies `fn` to a copy of the current thresholds and publishes the result.
+        template <typename Fn>
+        void update_levels(Fn&& fn) {
+            auto& ls = levels();
+            std::lock_guard lock(ls.mutex);
+            auto next = std::make_shared<level_snapshot>(*ls.current);
+            fn(*next);
+            update_core_threshold(*next);
+            std::atomic_store(&ls.current, std::shared_ptr<const level_snapshot>(std::move(next)));
+        }
+
+#if REALM_VERSION_MAJOR < 14
+        // Older databases do not tag messages with a category. The sync client prefixes its
+        // messages with the connection and session they concern, which is enough to tell
+        // those apart; everything else is reported under the root category.
+        std::string_view category_for_message(const std::string& msg) {
+            if (msg.rfind("Connection[", 0) == 0) {
+                return msg.find("Session[") != std::string::npos ? log_category::sync_client_session
+                                                                  : log_category::sync_client_network;
+            }
+            return log_category::realm;
+        }
+
+        // Whether `category_for_message` reports messages under `category` or below it.
+        bool is_reported(std::string_view category) {
+            for (std::string_view reported : {log_category::realm, log_category::sync_client_session,
+                                              log_category::sync_client_network}) {
+                if (reported.rfind(category, 0) == 0 &&
+                    (reported.size() == category.size() || reported[category.size()] == '.')) {
+                    return true;
+                }
+            }
+            return false;
+        }
+#endif
+    }
+
     struct internal_logger : public util::Logger {
         internal_logger(std::shared_ptr<logger> &&s) {
             m_logger = std::move(s);
         }
+#if REALM_VERSION_MAJOR >= 14
+        void do_log(const util::LogCategory& category, util::Logger::Level level, const std::string &msg) override {
+            log(category.get_name(), level, msg);
+        }
+#else
         void do_log(util::Logger::Level level, const std::string &msg) override {
-            m_logger->do_log(log_level_for_level(level), msg);
+            log(category_for_message(msg), level, msg);
         }
+#endif
 
     private:
+        void log(std::string_view category, util::Logger::Level level, const std::string &msg) {
+            auto l = log_level_for_level(level);
+            auto snapshot = current_levels();
+            if (!snapshot->levels.empty() && l < level_for(*snapshot, category)) {
+                return;
+            }
+            m_logger->log({l, category, msg, std::this_thread::get_id(), std::chrono::system_clock::now()});
+        }
+
         std::shared_ptr<logger> m_logger;
     };
 
@@ -79,6 +187,32 @@ namespace realm {
         util::Logger::set_default_logger(std::make_shared<internal_logger>(std::move(l)));
     }
     void set_default_level_threshold(logger::level l) {
-        util::Logger::set_default_level_threshold(log_level_for_level(l));
+        update_levels([l](level_snapshot& ls) {
+            ls.default_level = l;
+        });
+    }
+    void set_log_level(const std::string& category, logger::level l) {
+#if REALM_VERSION_MAJOR < 14
+        if (!is_reported(category)) {
+            // Setting it would only lower the database's threshold for nothing.
+            util::Logger::get_default_logger()->log(util::Logger::Level::warn,
+                                                    "Log category '%1' is not reported by this version of the database; its threshold is ignored",
+                                                    category);
+            return;
+        }
+#endif
+        update_levels([&category, l](level_snapshot& ls) {
+            ls.levels[category] = l;
+        });
+    }
+    void reset_log_level(std::string_view category) {
+        update_levels([category](level_snapshot& ls) {
+            if (auto it = ls.levels.find(category); it != ls.levels.end()) {
+                ls.levels.erase(it);
+            }
+        });
+    }
+    logger::level get_log_level(std::string_view category) {
+        return level_for(*current_levels(), category);
     }
-}
\ No newline at end of file
+}
@@ -1,10 +1,33 @@
 #ifndef CPP_REALM_LOGGER_HPP
 #define CPP_REALM_LOGGER_HPP
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <thread>
 
 namespace realm {
+    /// The categories log messages are reported under. Categories form a hierarchy separated by
+    /// dots, and a threshold set on a category applies to all categories below it unless they
+    /// have their own.
+    namespace log_category {
+        inline constexpr const char* realm = "Realm";
+        inline constexpr const char* storage = "Realm.Storage";
+        inline constexpr const char* transaction = "Realm.Storage.Transaction";
+        inline constexpr const char* query = "Realm.Storage.Query";
+        inline constexpr const char* object = "Realm.Storage.Object";
+        inline constexpr const char* notification = "Realm.Storage.Notification";
+        inline constexpr const char* sync = "Realm.Sync";
+        inline constexpr const char* sync_client = "Realm.Sync.Client";
+        inline constexpr const char* sync_client_session = "Realm.Sync.Client.Session";
+        inline constexpr const char* sync_client_changeset = "Realm.Sync.Client.Changeset";
+        inline constexpr const char* sync_client_network = "Realm.Sync.Client.Network";
+        inline constexpr const char* sync_client_reset = "Realm.Sync.Client.Reset";
+        inline constexpr const char* app = "Realm.App";
+        inline constexpr const char* sdk = "Realm.SDK";
+    }
+
     struct logger {
         /// Specifies criticality when passed to log().
         ///
@@ -27,12 +50,46 @@ namespace realm {
                            error = 6,
                            fatal = 7,
                            off = 8 };
-        virtual void do_log(level, const std::string &) = 0;
+
+        /// A log message with the context it was logged in.
+        struct record {
+            logger::level level;
+            /// One of the `log_category` names.
+            std::string_view category;
+            std::string_view message;
+            std::thread::id thread_id;
+            std::chrono::system_clock::time_point timestamp;
+        };
+
+        /// Receives the text of each message. Override `log(const record&)` instead to
+        /// receive the category, thread and time as separate fields.
+        virtual void do_log(level, const std::string &) {}
+        /// Receives each message with its context. By default forwards the message to `do_log`.
+        virtual void log(const record& r) {
+            do_log(r.level, std::string(r.message));
+        }
         virtual inline ~logger() noexcept = default;
     };
 
     void set_default_logger(std::shared_ptr<struct logger> &&);
+    /// Sets the threshold of every category which has no threshold of its own.
     void set_default_level_threshold(logger::level);
+    /// Sets the threshold of `category` and of the categories below it which have no
+    /// threshold of their own, e.g. `set_log_level(log_category::sync_client, logger::level::debug)`.
+    ///
+    /// Sync client messages are additionally filtered by the sync manager's log level, see
+    /// `sync_manager::set_log_level`.
+    ///
+    /// Databases before version 14 do not report categories. Their sync client messages are
+    /// reported under `sync_client_session` or `sync_client_network` and all other messages
+    /// under `realm`, so only those categories and their ancestors can be set; thresholds of
+    /// other categories are ignored with a warning.
+    void set_log_level(const std::string& category, logger::level);
+    /// Removes the threshold of `category`, which then inherits the threshold of its closest
+    /// ancestor again.
+    void reset_log_level(std::string_view category);
+    /// The threshold which applies to messages in `category`.
+    logger::level get_log_level(std::string_view category);
 }
 
 #endif//CPP_REALM_LOGGER_HPP
@@ -1,6 +1,13 @@
 #include <cpprealm/scheduler.hpp>
 
 #include <realm/object-store/util/scheduler.hpp>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <system_error>
+#endif
 #ifdef QT_CORE_LIB
 #include <QStandardPaths>
 #include <QMetaObject>
@@ -77,4 +84,215 @@ namespace realm {
 #endif
         return std::make_shared<platform_default_scheduler>();
     }
+
+#if defined(__linux__)
+    // Everything the loop touches while it runs. The owned thread holds its own reference, so
+    // a function running on it may release the last reference to the scheduler.
+    struct event_loop_scheduler::loop {
+        struct node {
+            std::atomic<node*> next = nullptr;
+            Function<void()> fn;
+        };
+
+        loop();
+        ~loop();
+
+        void run();
+        bool run_once(int timeout_ms);
+        void signal();
+        void push(Function<void()>&& fn);
+        size_t drain();
+        void wait(int timeout_ms);
+
+        int epoll_fd = -1;
+        int event_fd = -1;
+        // Intrusive MPSC queue: producers swap themselves into head, the loop consumes from tail.
+        std::atomic<node*> head;
+        node* tail;
+        std::unique_ptr<node> stub;
+        std::atomic<int64_t> pending = 0;
+        std::atomic<bool> stopped = false;
+        std::atomic<std::thread::id> thread_id;
+    };
+
+    event_loop_scheduler::loop::loop()
+        : stub(std::make_unique<node>()), thread_id(std::this_thread::get_id()) {
+        head.store(stub.get());
+        tail = stub.get();
+
+        event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (event_fd == -1) {
+            throw std::system_error(errno, std::generic_category(), "eventfd");
+        }
+        epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd == -1) {
+            ::close(event_fd);
+            throw std::system_error(errno, std::generic_category(), "epoll_create1");
+        }
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = event_fd;
+        if (::epoll_ctl(epoll_fd, EPOLL_CTL_ADD, event_fd, &event) == -1) {
+            ::close(epoll_fd);
+            ::close(event_fd);
+            throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+        }
+    }
+
+    event_loop_scheduler::loop::~loop() {
+        // Free anything that was queued but never run.
+        while (auto n = tail->next.load(std::memory_order_acquire)) {
+            if (tail != stub.get()) {
+                delete tail;
+            }
+            tail = n;
+        }
+        if (tail != stub.get()) {
+            delete tail;
+        }
+        ::close(epoll_fd);
+        ::close(event_fd);
+    }
+
+    void event_loop_scheduler::loop::run() {
+        thread_id = std::this_thread::get_id();
+        while (!stopped.load(std::memory_order_acquire)) {
+            run_once(-1);
+        }
+    }
+
+    bool event_loop_scheduler::loop::run_once(int timeout_ms) {
+        thread_id = std::this_thread::get_id();
+        size_t ran = drain();
+        if (ran == 0 && pending.load(std::memory_order_acquire) == 0 && !stopped.load(std::memory_order_acquire)) {
+            wait(timeout_ms);
+            ran = drain();
+        }
+        return ran > 0;
+    }
+
+    void event_loop_scheduler::loop::signal() {
+        uint64_t one = 1;
+        [[maybe_unused]] auto r = ::write(event_fd, &one, sizeof(one));
+    }
+
+    void event_loop_scheduler::loop::push(Function<void()>&& fn) {
+        auto n = new node;
+        n->fn = std::move(fn);
+        // Count the node before publishing it so the loop never goes to sleep
+        // while a push it has not seen yet is in flight.
+        bool was_idle = pending.fetch_add(1, std::memory_order_acq_rel) == 0;
+        node* prev = head.exchange(n, std::memory_order_acq_rel);
+        prev->next.store(n, std::memory_order_release);
+        if (was_idle) {
+            signal();
+        }
+    }
+
+    size_t event_loop_scheduler::loop::drain() {
+        size_t ran = 0;
+        while (true) {
+            node* t = tail;
+            node* next = t->next.load(std::memory_order_acquire);
+            if (t == stub.get()) {
+                if (!next) {
+                    break;
+                }
+                tail = next;
+                t = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+            if (!next) {
+                if (t != head.load(std::memory_order_acquire)) {
+                    // A producer has swapped in a node but not linked it yet.
+                    std::this_thread::yield();
+                    continue;
+                }
+                // Re-insert the stub behind the last node so it can be consumed.
+                stub->next.store(nullptr, std::memory_order_relaxed);
+                node* prev = head.exchange(stub.get(), std::memory_order_acq_rel);
+                prev->next.store(stub.get(), std::memory_order_release);
+                next = t->next.load(std::memory_order_acquire);
+                if (!next) {
+                    std::this_thread::yield();
+                    continue;
+                }
+            }
+            tail = next;
+            std::unique_ptr<node> owned(t);
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+            owned->fn();
+            ++ran;
+        }
+        return ran;
+    }
+
+    void event_loop_scheduler::loop::wait(int timeout_ms) {
+        epoll_event event{};
+        int n = ::epoll_wait(epoll_fd, &event, 1, timeout_ms);
+        if (n > 0) {
+            uint64_t count;
+            [[maybe_unused]] auto r = ::read(event_fd, &count, sizeof(count));
+        }
+    }
+
+    event_loop_scheduler::event_loop_scheduler()
+        : m_loop(std::make_shared<loop>()) {}
+
+    event_loop_scheduler::~event_loop_scheduler() {
+        stop();
+        if (m_thread.joinable()) {
+            // The last reference was released by a function running on the owned thread.
+            // The thread keeps the loop alive and exits once that function returns.
+            m_thread.detach();
+        }
+    }
+
+    void event_loop_scheduler::start() {
+        if (m_thread.joinable()) {
+            return;
+        }
+        m_loop->stopped = false;
+        m_thread = std::thread([l = m_loop] {
+            l->run();
+        });
+        m_loop->thread_id = m_thread.get_id();
+    }
+
+    void event_loop_scheduler::run() {
+        // Hold a reference in case a function on the loop releases the scheduler.
+        auto l = m_loop;
+        l->stopped = false;
+        l->run();
+    }
+
+    bool event_loop_scheduler::run_once(std::chrono::milliseconds timeout) {
+        auto l = m_loop;
+        return l->run_once(static_cast<int>(timeout.count()));
+    }
+
+    void event_loop_scheduler::stop() {
+        m_loop->stopped.store(true, std::memory_order_release);
+        m_loop->signal();
+        if (m_thread.joinable() && m_thread.get_id() != std::this_thread::get_id()) {
+            m_thread.join();
+        }
+    }
+
+    void event_loop_scheduler::invoke(Function<void()> &&fn) {
+        m_loop->push(std::move(fn));
+    }
+
+    bool event_loop_scheduler::is_on_thread() const noexcept {
+        return m_loop->thread_id.load() == std::this_thread::get_id();
+    }
+
+    bool event_loop_scheduler::is_same_as(const scheduler *other) const noexcept {
+        return this == other;
+    }
+
+    bool event_loop_scheduler::can_invoke() const noexcept {
+        return !m_loop->stopped.load(std::memory_order_acquire);
+    }
+#endif
 }
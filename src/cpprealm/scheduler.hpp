@@ -1,9 +1,13 @@
 #ifndef CPP_REALM_SCHEDULER_HPP
 #define CPP_REALM_SCHEDULER_HPP
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <future>
+#include <memory>
 #include <queue>
+#include <thread>
 
 namespace realm {
 namespace util {
@@ -42,5 +46,45 @@ using Function = util::UniqueFunction<Fn>;
         // This function is not thread-safe.
         [[nodiscard]] virtual bool can_invoke() const noexcept = 0;
     };
+
+#if defined(__linux__)
+    // A scheduler backed by its own epoll/eventfd event loop, for processes that have
+    // no platform run loop (e.g. headless servers). Notifications and async callbacks
+    // for realms opened with this scheduler are delivered as soon as the loop runs,
+    // without calling `refresh()` by hand.
+    //
+    // The loop either runs on a thread owned by the scheduler (`start()`), or on the
+    // caller's thread through `run()` / `run_once()`. Realms using this scheduler must
+    // be opened and used on the loop's thread, e.g. from within `invoke`.
+    struct event_loop_scheduler final : public scheduler {
+        event_loop_scheduler();
+        ~event_loop_scheduler() final;
+        event_loop_scheduler(const event_loop_scheduler&) = delete;
+        event_loop_scheduler& operator=(const event_loop_scheduler&) = delete;
+
+        // Spawns the owned thread and runs the loop on it until `stop()` is called.
+        void start();
+        // Runs the loop on the calling thread until `stop()` is called. A scheduler that
+        // was stopped can be run again.
+        void run();
+        // Waits up to `timeout` for work and runs everything that is queued.
+        // Returns true if at least one function was invoked.
+        bool run_once(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+        // Makes `run()` return and joins the owned thread if there is one.
+        // This function can be called from any thread.
+        void stop();
+
+        // Lock-free unless the loop is idle, in which case the eventfd is signalled once.
+        void invoke(Function<void()> &&) override;
+        [[nodiscard]] bool is_on_thread() const noexcept override;
+        bool is_same_as(const scheduler *other) const noexcept override;
+        [[nodiscard]] bool can_invoke() const noexcept override;
+
+    private:
+        struct loop;
+        std::shared_ptr<loop> m_loop;
+        std::thread m_thread;
+    };
+#endif
 }
 #endif //CPP_REALM_SCHEDULER_HPP
@@ -0,0 +1,122 @@
+#include <cpprealm/thread_pool_executor.hpp>
+
+#include <algorithm>
+
+namespace realm {
+    namespace {
+        // The executor and worker index of the current thread, if it is a pool worker.
+        thread_local const thread_pool_executor* t_executor = nullptr;
+        thread_local size_t t_worker_index = 0;
+    }
+
+    thread_pool_executor::thread_pool_executor(size_t thread_count) {
+        thread_count = std::max<size_t>(thread_count, 1);
+        m_workers.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; i++) {
+            m_workers.push_back(std::make_unique<worker>());
+        }
+        m_threads.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; i++) {
+            m_threads.emplace_back([this, i] {
+                run(i);
+            });
+        }
+    }
+
+    thread_pool_executor::~thread_pool_executor() {
+        {
+            std::lock_guard lock(m_idle_mutex);
+            m_stopped = true;
+        }
+        m_idle.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    void thread_pool_executor::post(Function<void()>&& fn) {
+        size_t index = t_executor == this
+                ? t_worker_index
+                : m_next_worker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+        // Counted before it is pushed, so the worker that pops it can never take the count
+        // below zero.
+        m_queued.fetch_add(1, std::memory_order_release);
+        {
+            auto& w = *m_workers[index];
+            std::lock_guard lock(w.mutex);
+            w.tasks.push_back(std::move(fn));
+        }
+        // Taking the lock orders this notification after a worker's check of m_queued.
+        { std::lock_guard lock(m_idle_mutex); }
+        m_idle.notify_one();
+    }
+
+    bool thread_pool_executor::pop_local(size_t index, Function<void()>& task) {
+        auto& w = *m_workers[index];
+        std::lock_guard lock(w.mutex);
+        if (w.tasks.empty()) {
+            return false;
+        }
+        task = std::move(w.tasks.back());
+        w.tasks.pop_back();
+        return true;
+    }
+
+    bool thread_pool_executor::steal(size_t thief, Function<void()>& task) {
+        // Skip contended victims on the first pass; if that finds nothing, wait for their
+        // locks on the second pass instead of spinning until their owners let go.
+        bool contended = false;
+        for (int pass = 0; pass < 2; pass++) {
+            for (size_t i = 1; i < m_workers.size(); i++) {
+                auto& victim = *m_workers[(thief + i) % m_workers.size()];
+                std::unique_lock lock(victim.mutex, std::defer_lock);
+                if (pass == 0) {
+                    if (!lock.try_lock()) {
+                        contended = true;
+                        continue;
+                    }
+                } else {
+                    lock.lock();
+                }
+                if (victim.tasks.empty()) {
+                    continue;
+                }
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+            if (!contended) {
+                break;
+            }
+        }
+        return false;
+    }
+
+    void thread_pool_executor::run(size_t index) {
+        t_executor = this;
+        t_worker_index = index;
+        Function<void()> task;
+        while (true) {
+            if (pop_local(index, task) || steal(index, task)) {
+                m_queued.fetch_sub(1, std::memory_order_acq_rel);
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock lock(m_idle_mutex);
+            if (m_stopped && m_queued.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+            if (m_queued.load(std::memory_order_acquire) == 0) {
+                m_idle.wait(lock, [this] {
+                    return m_stopped || m_queued.load(std::memory_order_acquire) > 0;
+                });
+            } else {
+                // A task was counted but not pushed yet, or taken by another worker that has
+                // not decremented the count yet.
+                lock.unlock();
+                std::this_thread::yield();
+            }
+        }
+    }
+}
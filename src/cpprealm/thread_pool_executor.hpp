@@ -0,0 +1,97 @@
+#ifndef CPP_REALM_THREAD_POOL_EXECUTOR_HPP
+#define CPP_REALM_THREAD_POOL_EXECUTOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <cpprealm/scheduler.hpp>
+
+#include <realm/util/functional.hpp>
+
+namespace realm {
+
+    // A fixed-size pool of worker threads for CPU-heavy work that does not need to run on
+    // a particular realm's thread, such as detaching objects, serialization and scans
+    // over frozen snapshots.
+    //
+    // Each worker owns a deque: tasks posted from a worker go to the back of its own deque
+    // and are taken LIFO, while idle workers steal from the front of other workers' deques.
+    struct thread_pool_executor {
+        explicit thread_pool_executor(size_t thread_count = std::thread::hardware_concurrency());
+        ~thread_pool_executor();
+        thread_pool_executor(const thread_pool_executor&) = delete;
+        thread_pool_executor& operator=(const thread_pool_executor&) = delete;
+
+        // Runs `fn` on any worker.
+        //
+        // This function can be called from any thread.
+        void post(Function<void()>&& fn);
+
+        // Runs `fn` on any worker and returns a future for its result. `fn` may be move-only.
+        template <typename Fn>
+        std::future<std::invoke_result_t<Fn>> submit(Fn&& fn) {
+            std::packaged_task<std::invoke_result_t<Fn>()> task(std::forward<Fn>(fn));
+            auto future = task.get_future();
+            post([task = std::move(task)]() mutable { task(); });
+            return future;
+        }
+
+        // Runs `work` on any worker, then hands its result to `completion` on `target`'s
+        // thread. Use this for work whose result must be consumed by a thread-confined realm.
+        template <typename Fn, typename Completion>
+        void submit(Fn&& work, std::shared_ptr<scheduler> target, Completion&& completion) {
+            post([work = std::forward<Fn>(work), target = std::move(target),
+                  completion = std::forward<Completion>(completion)]() mutable {
+                if constexpr (std::is_void_v<std::invoke_result_t<Fn>>) {
+                    work();
+                    target->invoke([completion = std::move(completion)]() mutable { completion(); });
+                } else {
+                    target->invoke([completion = std::move(completion), result = work()]() mutable {
+                        completion(std::move(result));
+                    });
+                }
+            });
+        }
+
+        // Runs `fn` on any worker with a frozen snapshot of `db`. Frozen realms may be read
+        // from any thread, so the snapshot is taken on the caller's thread and handed over.
+        template <typename DB, typename Fn>
+        auto submit_frozen(const DB& db, Fn&& fn) {
+            return submit([frozen = db.freeze(), fn = std::forward<Fn>(fn)]() mutable {
+                return fn(frozen);
+            });
+        }
+
+        [[nodiscard]] size_t size() const noexcept {
+            return m_workers.size();
+        }
+
+    private:
+        struct worker {
+            std::mutex mutex;
+            std::deque<Function<void()>> tasks;
+        };
+
+        void run(size_t index);
+        bool pop_local(size_t index, Function<void()>& task);
+        bool steal(size_t thief, Function<void()>& task);
+
+        std::vector<std::unique_ptr<worker>> m_workers;
+        std::vector<std::thread> m_threads;
+        std::atomic<size_t> m_next_worker = 0;
+        std::atomic<size_t> m_queued = 0;
+        std::mutex m_idle_mutex;
+        std::condition_variable m_idle;
+        bool m_stopped = false;
+    };
+}
+
+#endif //CPP_REALM_THREAD_POOL_EXECUTOR_HPP
@@ -0,0 +1,165 @@
+#include <cpprealm/tracing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace realm::tracing {
+#ifdef CPPREALM_ENABLE_TRACING
+    namespace {
+        // Bounds the memory a thread may use for spans: 32 bytes each, 32MB per thread.
+        constexpr size_t max_events_per_thread = 1 << 20;
+
+        struct event {
+            const char* category;
+            const char* name;
+            int64_t start;
+            int64_t duration;
+        };
+
+        // The lock is only contended while the trace is being written or cleared.
+        struct thread_buffer {
+            std::mutex mutex;
+            std::vector<event> events;
+            uint64_t tid;
+        };
+
+        struct trace_registry {
+            std::mutex mutex;
+            // Buffers outlive their threads, so spans of exited threads are still written.
+            std::vector<std::shared_ptr<thread_buffer>> buffers;
+            std::atomic<bool> recording = false;
+            std::atomic<uint64_t> dropped = 0;
+            uint64_t next_tid = 1;
+            const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+        };
+
+        trace_registry& registry() {
+            static trace_registry r;
+            return r;
+        }
+
+        thread_buffer& local_buffer() {
+            thread_local std::shared_ptr<thread_buffer> buffer = [] {
+                auto& r = registry();
+                auto b = std::make_shared<thread_buffer>();
+                std::lock_guard lock(r.mutex);
+                b->tid = r.next_tid++;
+                r.buffers.push_back(b);
+                return b;
+            }();
+            return *buffer;
+        }
+
+        // Nanoseconds since the registry was created; always positive, so zero can mean "unset".
+        int64_t now() noexcept {
+            auto& r = registry();
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - r.epoch).count() + 1;
+        }
+
+        void write_escaped(std::ostream& out, const char* s) {
+            for (; *s; s++) {
+                if (*s == '"' || *s == '\\') {
+                    out << '\\';
+                }
+                out << *s;
+            }
+        }
+    }
+
+    span::span(const char* category, const char* name) noexcept
+        : m_category(category), m_name(name),
+          m_start(registry().recording.load(std::memory_order_relaxed) ? now() : 0) {}
+
+    span::span(span&& other) noexcept
+        : m_category(other.m_category), m_name(other.m_name), m_start(other.m_start) {
+        other.m_start = 0;
+    }
+
+    void span::end() noexcept {
+        if (!m_start) {
+            return;
+        }
+        auto duration = now() - m_start;
+        auto& buffer = local_buffer();
+        std::lock_guard lock(buffer.mutex);
+        if (buffer.events.size() >= max_events_per_thread) {
+            registry().dropped.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            buffer.events.push_back({m_category, m_name, m_start, duration});
+        }
+        m_start = 0;
+    }
+
+    void start() {
+        registry().recording.store(true, std::memory_order_relaxed);
+    }
+
+    void stop() {
+        registry().recording.store(false, std::memory_order_relaxed);
+    }
+
+    bool is_recording() noexcept {
+        return registry().recording.load(std::memory_order_relaxed);
+    }
+
+    void clear() {
+        auto& r = registry();
+        std::lock_guard lock(r.mutex);
+        for (auto& buffer : r.buffers) {
+            std::lock_guard buffer_lock(buffer->mutex);
+            buffer->events.clear();
+        }
+        r.dropped.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t dropped() noexcept {
+        return registry().dropped.load(std::memory_order_relaxed);
+    }
+
+    void write_chrome_trace(std::ostream& out) {
+        auto& r = registry();
+        std::lock_guard lock(r.mutex);
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool first = true;
+        for (auto& buffer : r.buffers) {
+            std::lock_guard buffer_lock(buffer->mutex);
+            for (auto& e : buffer->events) {
+                out << (first ? "\n" : ",\n") << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid << ",\"cat\":\"";
+                write_escaped(out, e.category);
+                out << "\",\"name\":\"";
+                write_escaped(out, e.name);
+                // Chrome trace timestamps are in microseconds.
+                out << "\",\"ts\":" << e.start / 1000 << '.' << std::to_string(1000 + e.start % 1000).substr(1)
+                    << ",\"dur\":" << e.duration / 1000 << '.' << std::to_string(1000 + e.duration % 1000).substr(1)
+                    << "}";
+                first = false;
+            }
+        }
+        out << "\n]}\n";
+    }
+#else
+    void start() {}
+    void stop() {}
+    bool is_recording() noexcept { return false; }
+    void clear() {}
+    uint64_t dropped() noexcept { return 0; }
+
+    void write_chrome_trace(std::ostream& out) {
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n";
+    }
+#endif
+
+    bool write_chrome_trace(const std::string& path) {
+        std::ofstream out(path, std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        write_chrome_trace(out);
+        return static_cast<bool>(out);
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef CPP_REALM_TRACING_HPP
+#define CPP_REALM_TRACING_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace realm::tracing {
+
+    // Event tracing of the SDK's hot paths: write transactions, commits, query evaluation,
+    // notification delivery, scheduler dispatch and HTTP requests.
+    //
+    // Spans are only compiled in when the SDK is built with `-DCPPREALM_ENABLE_TRACING=ON`;
+    // otherwise `CPPREALM_TRACE_SCOPE` expands to nothing and the functions below record
+    // nothing. Each thread appends its spans to its own buffer, so recording does not contend
+    // between threads. The trace is written in the Chrome trace event format, which can be
+    // opened with chrome://tracing or https://ui.perfetto.dev.
+    //
+    //     realm::tracing::start();
+    //     ... run the workload ...
+    //     realm::tracing::stop();
+    //     realm::tracing::write_chrome_trace("trace.json");
+
+    // Whether spans are compiled into this build.
+#ifdef CPPREALM_ENABLE_TRACING
+    inline constexpr bool compiled_in = true;
+#else
+    inline constexpr bool compiled_in = false;
+#endif
+
+    // Starts or stops recording. Recording is off until `start()` is called.
+    void start();
+    void stop();
+    [[nodiscard]] bool is_recording() noexcept;
+    // Discards the spans recorded so far.
+    void clear();
+    // The number of spans discarded because a thread's buffer was full.
+    [[nodiscard]] uint64_t dropped() noexcept;
+
+    // Writes the spans recorded by every thread as a Chrome trace JSON object.
+    void write_chrome_trace(std::ostream& out);
+    // Returns false if `path` could not be written.
+    bool write_chrome_trace(const std::string& path);
+
+#ifdef CPPREALM_ENABLE_TRACING
+    // Records the time between its construction and its destruction, or the call to `end()`,
+    // on the thread that ends it. `name` and `category` must be string literals.
+    struct span {
+        span(const char* category, const char* name) noexcept;
+        span(span&& other) noexcept;
+        span& operator=(span&&) = delete;
+        span(const span&) = delete;
+        span& operator=(const span&) = delete;
+        ~span() { end(); }
+
+        void end() noexcept;
+
+    private:
+        const char* m_category;
+        const char* m_name;
+        // Zero if recording was off when the span started, or it already ended.
+        int64_t m_start;
+    };
+
+#define CPPREALM_TRACE_CONCAT_IMPL(a, b) a##b
+#define CPPREALM_TRACE_CONCAT(a, b) CPPREALM_TRACE_CONCAT_IMPL(a, b)
+#define CPPREALM_TRACE_SCOPE(category, name) \
+    ::realm::tracing::span CPPREALM_TRACE_CONCAT(cpprealm_trace_span_, __LINE__)(category, name)
+#else
+#define CPPREALM_TRACE_SCOPE(category, name)
+#endif
+}
+
+#endif //CPP_REALM_TRACING_HPP
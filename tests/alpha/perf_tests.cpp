@@ -12,7 +12,7 @@ TEST_CASE("basic_alpha", "[performance]") {
 
         return meter.measure([&]() {
             realm.write([&] {
-                for (int64_t i = 0; i < 10000; i++) {
+                for (int64_t i = 0; i < 1000; i++) {
                     AllTypesObject o;
                     o._id = i;
                     realm.add(std::move(o));
@@ -20,7 +20,7 @@ TEST_CASE("basic_alpha", "[performance]") {
             });
         });
 
-        CHECK(realm.objects<AllTypesObject>().size() == 10000);
+        CHECK(realm.objects<AllTypesObject>().size() == 1000);
 
     };
 
@@ -31,7 +31,7 @@ TEST_CASE("basic_alpha", "[performance]") {
         auto realm = open<AllTypesObject, AllTypesObjectLink, AllTypesObjectEmbedded>(std::move(config));
 
         realm.write([&] {
-            for (int64_t i = 0; i < 10000; i++) {
+            for (int64_t i = 0; i < 1000; i++) {
                 AllTypesObject o;
                 o._id = i;
                 realm.add(std::move(o));
@@ -40,8 +40,8 @@ TEST_CASE("basic_alpha", "[performance]") {
 
         return meter.measure([&]() {
             auto results = realm.objects<AllTypesObject>();
-            CHECK(results.size() == 10000);
-            for (int64_t i = 0; i < 10000; i++) {
+            CHECK(results.size() == 1000);
+            for (int64_t i = 0; i < 1000; i++) {
                 CHECK(results[i]._id == i);
             }
         });
@@ -0,0 +1,19 @@
+#include "app_services_stand_in.hpp"
+
+#include <cstdlib>
+#include <iostream>
+
+// Runs the App Services stand-in until stdin is closed, e.g. to point an app or a load
+// generator at it from outside the test binaries:
+//
+//     cpprealm_app_services_stand_in 9090
+int main(int argc, char** argv) {
+    auto port = argc > 1 ? static_cast<uint16_t>(std::atoi(argv[1])) : uint16_t(0);
+    app_services_stand_in server(port);
+    std::cout << "App Services stand-in listening on " << server.base_url() << std::endl;
+    std::string line;
+    while (std::getline(std::cin, line)) {}
+    std::cout << "Served " << server.requests_served() << " requests on "
+              << server.connections_accepted() << " connections" << std::endl;
+    return 0;
+}
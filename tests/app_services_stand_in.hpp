@@ -0,0 +1,156 @@
+#ifndef CPPREALM_TESTS_APP_SERVICES_STAND_IN_HPP
+#define CPPREALM_TESTS_APP_SERVICES_STAND_IN_HPP
+
+#include "local_http_server.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// An in-process stand-in for the Atlas App Services HTTP endpoints used by `realm::App`:
+// location, login with any provider, profile, access token refresh, logout and function calls.
+// Functions echo their arguments back, so `call_function("any", {1, 2})` returns `[1, 2]`,
+// except for the function named "fail", which fails with a FunctionExecutionError, and the
+// function named "slow", which waits 50ms before echoing.
+//
+// This only covers the HTTP API; sync needs a real server. Use it to measure the SDK and
+// transport overhead of app requests offline:
+//
+//     app_services_stand_in server;
+//     auto app = realm::App(realm::App::configuration({"stand-in", server.base_url()}));
+class app_services_stand_in {
+public:
+    explicit app_services_stand_in(uint16_t port = 0)
+        : m_server([this](const std::string& method, const std::string& path, const std::string& body) {
+            return handle(method, path, body);
+        }, port) {}
+
+    [[nodiscard]] std::string base_url() const {
+        return m_server.url("");
+    }
+
+    [[nodiscard]] uint16_t port() const { return m_server.port(); }
+    [[nodiscard]] size_t requests_served() const { return m_server.requests_served(); }
+    [[nodiscard]] size_t connections_accepted() const { return m_server.connections_accepted(); }
+    [[nodiscard]] size_t peak_requests_in_flight() const { return m_server.peak_requests_in_flight(); }
+
+private:
+    static bool ends_with(const std::string& s, const std::string& suffix) {
+        return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    static std::string base64url(const std::string& in) {
+        static constexpr char chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+        std::string out;
+        size_t i = 0;
+        for (; i + 2 < in.size(); i += 3) {
+            uint32_t n = (uint8_t(in[i]) << 16) | (uint8_t(in[i + 1]) << 8) | uint8_t(in[i + 2]);
+            out += {chars[(n >> 18) & 63], chars[(n >> 12) & 63], chars[(n >> 6) & 63], chars[n & 63]};
+        }
+        if (i + 1 == in.size()) {
+            uint32_t n = uint8_t(in[i]) << 16;
+            out += {chars[(n >> 18) & 63], chars[(n >> 12) & 63]};
+        } else if (i + 2 == in.size()) {
+            uint32_t n = (uint8_t(in[i]) << 16) | (uint8_t(in[i + 1]) << 8);
+            out += {chars[(n >> 18) & 63], chars[(n >> 12) & 63], chars[(n >> 6) & 63]};
+        }
+        return out;
+    }
+
+    // An unsigned JWT, which is all the SDK inspects: it reads the expiry from the payload.
+    static std::string make_token(const std::string& user_id) {
+        auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        auto payload = "{\"exp\":" + std::to_string(now + 24 * 60 * 60) + ",\"iat\":" + std::to_string(now) +
+                       ",\"sub\":\"" + user_id + "\"}";
+        return base64url("{\"alg\":\"HS256\",\"typ\":\"JWT\"}") + "." + base64url(payload) + ".stand-in";
+    }
+
+    // Returns the string value of `"name":` in `body`, or an empty string.
+    static std::string extract_name(const std::string& body) {
+        auto key = body.find("\"name\"");
+        auto colon = key == std::string::npos ? std::string::npos : body.find(':', key);
+        auto start = colon == std::string::npos ? std::string::npos : body.find('"', colon);
+        auto end = start == std::string::npos ? std::string::npos : body.find('"', start + 1);
+        if (end == std::string::npos) {
+            return {};
+        }
+        return body.substr(start + 1, end - start - 1);
+    }
+
+    // Returns the JSON array following `"arguments":` in `body`, or `[]`.
+    static std::string extract_arguments(const std::string& body) {
+        auto key = body.find("\"arguments\"");
+        auto start = key == std::string::npos ? std::string::npos : body.find('[', key);
+        if (start == std::string::npos) {
+            return "[]";
+        }
+        int depth = 0;
+        bool in_string = false;
+        for (size_t i = start; i < body.size(); i++) {
+            char c = body[i];
+            if (in_string) {
+                if (c == '\\') {
+                    i++;
+                } else if (c == '"') {
+                    in_string = false;
+                }
+            } else if (c == '"') {
+                in_string = true;
+            } else if (c == '[' || c == '{') {
+                depth++;
+            } else if ((c == ']' || c == '}') && --depth == 0) {
+                return body.substr(start, i - start + 1);
+            }
+        }
+        return "[]";
+    }
+
+    local_http_server::response handle(const std::string& method, const std::string& path, const std::string& body) {
+        if (ends_with(path, "/location")) {
+            return {200, "{\"deployment_model\":\"GLOBAL\",\"location\":\"US-VA\",\"hostname\":\"" + base_url() +
+                         "\",\"ws_hostname\":\"ws://127.0.0.1:" + std::to_string(port()) + "\"}"};
+        }
+        if (ends_with(path, "/login")) {
+            std::lock_guard lock(m_mutex);
+            char id[25];
+            std::snprintf(id, sizeof(id), "%024zx", ++m_user_count);
+            m_last_user_id = id;
+            return {200, "{\"access_token\":\"" + make_token(m_last_user_id) + "\",\"refresh_token\":\"" +
+                         make_token(m_last_user_id) + "\",\"user_id\":\"" + m_last_user_id +
+                         "\",\"device_id\":\"000000000000000000000000\"}"};
+        }
+        if (ends_with(path, "/auth/profile")) {
+            std::lock_guard lock(m_mutex);
+            return {200, "{\"user_id\":\"" + m_last_user_id + "\",\"domain_id\":\"000000000000000000000000\","
+                         "\"identities\":[{\"id\":\"" + m_last_user_id + "\",\"provider_type\":\"anon-user\","
+                         "\"provider_id\":\"000000000000000000000000\"}],\"data\":{},\"type\":\"normal\"}"};
+        }
+        if (ends_with(path, "/auth/session")) {
+            if (method == "DELETE") {
+                return {200, "{}"};
+            }
+            std::lock_guard lock(m_mutex);
+            return {201, "{\"access_token\":\"" + make_token(m_last_user_id) + "\"}"};
+        }
+        if (ends_with(path, "/functions/call")) {
+            if (extract_name(body) == "fail") {
+                return {400, "{\"error\":\"function failed\",\"error_code\":\"FunctionExecutionError\"}"};
+            }
+            if (extract_name(body) == "slow") {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+            return {200, extract_arguments(body)};
+        }
+        return {404, "{\"error\":\"not found\",\"error_code\":\"NotFound\"}"};
+    }
+
+    std::mutex m_mutex;
+    size_t m_user_count = 0;
+    std::string m_last_user_id;
+    local_http_server m_server;
+};
+
+#endif //CPPREALM_TESTS_APP_SERVICES_STAND_IN_HPP
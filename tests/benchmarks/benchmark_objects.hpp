@@ -0,0 +1,178 @@
+#ifndef CPPREALM_BENCHMARK_OBJECTS_HPP
+#define CPPREALM_BENCHMARK_OBJECTS_HPP
+
+#include <cpprealm/experimental/sdk.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace realm::experimental {
+    // Four properties.
+    struct BenchNarrowObject {
+        primary_key<int64_t> _id;
+        int64_t int_col = 0;
+        std::string str_col;
+        double double_col = 0;
+    };
+    REALM_SCHEMA(BenchNarrowObject, _id, int_col, str_col, double_col)
+
+    // Thirty-two properties, with the same leading properties as BenchNarrowObject so the
+    // same benchmarks run against both.
+    struct BenchWideObject {
+        primary_key<int64_t> _id;
+        int64_t int_col = 0;
+        std::string str_col;
+        double double_col = 0;
+        int64_t int_col_1 = 0;
+        int64_t int_col_2 = 0;
+        int64_t int_col_3 = 0;
+        int64_t int_col_4 = 0;
+        int64_t int_col_5 = 0;
+        int64_t int_col_6 = 0;
+        int64_t int_col_7 = 0;
+        int64_t int_col_8 = 0;
+        int64_t int_col_9 = 0;
+        int64_t int_col_10 = 0;
+        std::string str_col_1;
+        std::string str_col_2;
+        std::string str_col_3;
+        std::string str_col_4;
+        std::string str_col_5;
+        std::string str_col_6;
+        std::string str_col_7;
+        std::string str_col_8;
+        std::string str_col_9;
+        std::string str_col_10;
+        double double_col_1 = 0;
+        double double_col_2 = 0;
+        double double_col_3 = 0;
+        double double_col_4 = 0;
+        double double_col_5 = 0;
+        double double_col_6 = 0;
+        double double_col_7 = 0;
+        double double_col_8 = 0;
+    };
+    REALM_SCHEMA(BenchWideObject, _id, int_col, str_col, double_col,
+                 int_col_1, int_col_2, int_col_3, int_col_4, int_col_5,
+                 int_col_6, int_col_7, int_col_8, int_col_9, int_col_10,
+                 str_col_1, str_col_2, str_col_3, str_col_4, str_col_5,
+                 str_col_6, str_col_7, str_col_8, str_col_9, str_col_10,
+                 double_col_1, double_col_2, double_col_3, double_col_4,
+                 double_col_5, double_col_6, double_col_7, double_col_8)
+
+    // One property of each type, for the per-type accessor benchmarks.
+    struct BenchTypesObject {
+        enum class Enum {
+            one, two
+        };
+
+        primary_key<int64_t> _id;
+        int64_t int_col = 0;
+        double double_col = 0;
+        bool bool_col = false;
+        std::string str_col;
+        Enum enum_col = Enum::one;
+        std::chrono::time_point<std::chrono::system_clock> date_col;
+        realm::uuid uuid_col;
+        realm::object_id object_id_col;
+        realm::decimal128 decimal_col;
+        std::vector<std::uint8_t> binary_col;
+        realm::mixed mixed_col;
+        std::optional<int64_t> opt_int_col;
+        std::optional<std::string> opt_str_col;
+    };
+    REALM_SCHEMA(BenchTypesObject, _id, int_col, double_col, bool_col, str_col, enum_col, date_col,
+                 uuid_col, object_id_col, decimal_col, binary_col, mixed_col, opt_int_col, opt_str_col)
+
+    struct BenchCollectionObject {
+        primary_key<int64_t> _id;
+        std::vector<int64_t> list_int_col;
+        std::vector<std::string> list_str_col;
+        std::set<int64_t> set_int_col;
+        std::set<std::string> set_str_col;
+        std::map<std::string, int64_t> map_int_col;
+        std::map<std::string, std::string> map_str_col;
+    };
+    REALM_SCHEMA(BenchCollectionObject, _id, list_int_col, list_str_col, set_int_col, set_str_col,
+                 map_int_col, map_str_col)
+}
+
+namespace benchmarks {
+    // The object counts every object benchmark runs with.
+    inline const std::vector<int64_t> object_counts = {100, 1000, 10000};
+    // The element counts every collection benchmark runs with.
+    inline const std::vector<int64_t> element_counts = {10, 1000, 100000};
+
+    // Returns object `i` of a data set, with every property set to a value derived from `i`.
+    template <typename T>
+    T make_object(int64_t i);
+
+    template <>
+    inline realm::experimental::BenchNarrowObject make_object(int64_t i) {
+        realm::experimental::BenchNarrowObject o;
+        o._id = i;
+        o.int_col = i;
+        o.str_col = "str_" + std::to_string(i);
+        o.double_col = static_cast<double>(i) / 2;
+        return o;
+    }
+
+    template <>
+    inline realm::experimental::BenchWideObject make_object(int64_t i) {
+        realm::experimental::BenchWideObject o;
+        o._id = i;
+        o.int_col = i;
+        o.str_col = "str_" + std::to_string(i);
+        o.double_col = static_cast<double>(i) / 2;
+        for (auto p : {&o.int_col_1, &o.int_col_2, &o.int_col_3, &o.int_col_4, &o.int_col_5,
+                       &o.int_col_6, &o.int_col_7, &o.int_col_8, &o.int_col_9, &o.int_col_10}) {
+            *p = i;
+        }
+        for (auto p : {&o.str_col_1, &o.str_col_2, &o.str_col_3, &o.str_col_4, &o.str_col_5,
+                       &o.str_col_6, &o.str_col_7, &o.str_col_8, &o.str_col_9, &o.str_col_10}) {
+            *p = o.str_col;
+        }
+        for (auto p : {&o.double_col_1, &o.double_col_2, &o.double_col_3, &o.double_col_4,
+                       &o.double_col_5, &o.double_col_6, &o.double_col_7, &o.double_col_8}) {
+            *p = o.double_col;
+        }
+        return o;
+    }
+
+    // A data set of `count` objects with ids starting at `first_id`.
+    template <typename T>
+    std::vector<T> make_objects(int64_t count, int64_t first_id = 0) {
+        std::vector<T> objects;
+        objects.reserve(static_cast<size_t>(count));
+        for (int64_t i = 0; i < count; i++) {
+            objects.push_back(make_object<T>(first_id + i));
+        }
+        return objects;
+    }
+
+    // Opens a new, empty realm at `path`.
+    inline realm::experimental::db open(const std::string& path) {
+        realm::db_config config;
+        config.set_path(path);
+        return realm::experimental::db(std::move(config));
+    }
+
+    // Opens a new realm at `path` holding `count` objects of type T.
+    template <typename T>
+    realm::experimental::db open_with_objects(const std::string& path, int64_t count) {
+        auto realm = open(path);
+        const auto objects = make_objects<T>(count);
+        realm.write([&] {
+            realm.insert(objects);
+        });
+        return realm;
+    }
+
+    template <typename T>
+    std::string benchmark_name(const std::string& operation, int64_t count) {
+        return operation + " " + std::string(realm::experimental::managed<T>::schema.name) + " x" + std::to_string(count);
+    }
+}
+
+#endif //CPPREALM_BENCHMARK_OBJECTS_HPP
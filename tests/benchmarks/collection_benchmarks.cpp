@@ -0,0 +1,224 @@
+#include "../main.hpp"
+#include "benchmark_objects.hpp"
+
+using namespace realm;
+using namespace realm::experimental;
+
+namespace {
+    managed<BenchCollectionObject> add_collection_object(db& realm) {
+        return realm.write([&realm] {
+            return realm.add(BenchCollectionObject());
+        });
+    }
+
+    std::vector<int64_t> make_ints(int64_t count) {
+        std::vector<int64_t> values;
+        values.reserve(static_cast<size_t>(count));
+        for (int64_t i = 0; i < count; i++) {
+            values.push_back(i);
+        }
+        return values;
+    }
+
+    std::vector<std::pair<std::string, int64_t>> make_entries(int64_t count) {
+        std::vector<std::pair<std::string, int64_t>> values;
+        values.reserve(static_cast<size_t>(count));
+        for (int64_t i = 0; i < count; i++) {
+            values.emplace_back("key_" + std::to_string(i), i);
+        }
+        return values;
+    }
+
+    std::string name(const std::string& operation, int64_t count) {
+        return operation + " x" + std::to_string(count);
+    }
+}
+
+TEST_CASE("list_benchmarks", "[benchmark]") {
+    for (auto count : benchmarks::element_counts) {
+        auto values = make_ints(count);
+
+        BENCHMARK_ADVANCED(name("list push_back", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            meter.measure([&] {
+                realm.write([&] {
+                    o.list_int_col.clear();
+                    for (auto v : values) {
+                        o.list_int_col.push_back(v);
+                    }
+                });
+            });
+        };
+
+        BENCHMARK_ADVANCED(name("list assign", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            meter.measure([&] {
+                realm.write([&] {
+                    o.list_int_col.assign(values);
+                });
+            });
+        };
+
+        BENCHMARK_ADVANCED(name("list get", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            realm.write([&] {
+                o.list_int_col.assign(values);
+            });
+            meter.measure([&] {
+                int64_t sum = 0;
+                for (size_t i = 0; i < values.size(); i++) {
+                    sum += o.list_int_col[i];
+                }
+                return sum;
+            });
+        };
+
+        BENCHMARK_ADVANCED(name("list iterate", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            realm.write([&] {
+                o.list_int_col.assign(values);
+            });
+            meter.measure([&] {
+                int64_t sum = 0;
+                for (auto v : o.list_int_col) {
+                    sum += v;
+                }
+                return sum;
+            });
+        };
+
+        BENCHMARK_ADVANCED(name("list detach", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            realm.write([&] {
+                o.list_int_col.assign(values);
+            });
+            meter.measure([&] {
+                return o.list_int_col.detach().size();
+            });
+        };
+    }
+}
+
+TEST_CASE("set_benchmarks", "[benchmark]") {
+    for (auto count : benchmarks::element_counts) {
+        auto values = make_ints(count);
+
+        BENCHMARK_ADVANCED(name("set insert", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            meter.measure([&] {
+                realm.write([&] {
+                    o.set_int_col.clear();
+                    for (auto v : values) {
+                        o.set_int_col.insert(v);
+                    }
+                });
+            });
+        };
+
+        BENCHMARK_ADVANCED(name("set find", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            realm.write([&] {
+                for (auto v : values) {
+                    o.set_int_col.insert(v);
+                }
+            });
+            meter.measure([&] {
+                size_t found = 0;
+                for (auto v : values) {
+                    if (o.set_int_col.find(v) != o.set_int_col.end()) {
+                        found++;
+                    }
+                }
+                return found;
+            });
+        };
+
+        BENCHMARK_ADVANCED(name("set detach", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            realm.write([&] {
+                for (auto v : values) {
+                    o.set_int_col.insert(v);
+                }
+            });
+            meter.measure([&] {
+                return o.set_int_col.detach().size();
+            });
+        };
+    }
+}
+
+TEST_CASE("map_benchmarks", "[benchmark]") {
+    for (auto count : benchmarks::element_counts) {
+        auto entries = make_entries(count);
+
+        BENCHMARK_ADVANCED(name("map set", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            meter.measure([&] {
+                realm.write([&] {
+                    for (auto& [k, v] : entries) {
+                        o.map_int_col[k] = v;
+                    }
+                });
+            });
+        };
+
+        BENCHMARK_ADVANCED(name("map bulk insert", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            meter.measure([&] {
+                realm.write([&] {
+                    o.map_int_col.insert(entries);
+                });
+            });
+        };
+
+        BENCHMARK_ADVANCED(name("map lookup", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            realm.write([&] {
+                o.map_int_col.insert(entries);
+            });
+            meter.measure([&] {
+                size_t found = 0;
+                for (auto& [k, v] : entries) {
+                    if (o.map_int_col.contains(std::string_view(k))) {
+                        found++;
+                    }
+                }
+                return found;
+            });
+        };
+
+        BENCHMARK_ADVANCED(name("map detach", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = add_collection_object(realm);
+            realm.write([&] {
+                o.map_int_col.insert(entries);
+            });
+            meter.measure([&] {
+                return o.map_int_col.detach().size();
+            });
+        };
+    }
+}
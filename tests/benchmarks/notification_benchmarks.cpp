@@ -0,0 +1,70 @@
+#include "../main.hpp"
+#include "benchmark_objects.hpp"
+
+using namespace realm;
+using namespace realm::experimental;
+
+// Measures the time from a commit to its notification being delivered, which includes
+// computing the changes in the notifier and calling the handler on the realm's thread.
+TEMPLATE_TEST_CASE("notification_benchmarks", "[benchmark]", BenchNarrowObject, BenchWideObject) {
+    for (auto count : benchmarks::object_counts) {
+        BENCHMARK_ADVANCED(benchmarks::benchmark_name<TestType>("results notification", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open_with_objects<TestType>(path, count);
+            auto results = realm.objects<TestType>();
+            size_t notifications = 0;
+            auto token = results.observe([&notifications](auto&&) {
+                notifications++;
+            });
+            realm.refresh();
+            auto o = results[static_cast<size_t>(count / 2)];
+            meter.measure([&](int run) {
+                realm.write([&] {
+                    o.int_col = run;
+                });
+                realm.refresh();
+            });
+            CHECK(notifications > 0);
+        };
+
+        BENCHMARK_ADVANCED(benchmarks::benchmark_name<TestType>("query notification", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open_with_objects<TestType>(path, count);
+            auto threshold = count / 2;
+            auto results = realm.objects<TestType>().where([threshold](auto& o) {
+                return o.int_col >= threshold;
+            });
+            size_t notifications = 0;
+            auto token = results.observe([&notifications](auto&&) {
+                notifications++;
+            });
+            realm.refresh();
+            auto o = realm.objects<TestType>()[static_cast<size_t>(count - 1)];
+            meter.measure([&](int run) {
+                realm.write([&] {
+                    o.int_col = count + run;
+                });
+                realm.refresh();
+            });
+            CHECK(notifications > 0);
+        };
+
+        BENCHMARK_ADVANCED(benchmarks::benchmark_name<TestType>("object notification", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open_with_objects<TestType>(path, count);
+            auto o = realm.objects<TestType>()[static_cast<size_t>(count / 2)];
+            size_t notifications = 0;
+            auto token = o.observe([&notifications](auto&&) {
+                notifications++;
+            });
+            realm.refresh();
+            meter.measure([&](int run) {
+                realm.write([&] {
+                    o.int_col = run;
+                });
+                realm.refresh();
+            });
+            CHECK(notifications > 0);
+        };
+    }
+}
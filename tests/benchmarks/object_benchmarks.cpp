@@ -0,0 +1,130 @@
+#include "../main.hpp"
+#include "benchmark_objects.hpp"
+
+using namespace realm;
+using namespace realm::experimental;
+
+TEMPLATE_TEST_CASE("object_benchmarks", "[benchmark]", BenchNarrowObject, BenchWideObject) {
+    for (auto count : benchmarks::object_counts) {
+        BENCHMARK_ADVANCED(benchmarks::benchmark_name<TestType>("add", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            // Each run adds a fresh set of objects, as primary keys may only be used once.
+            std::vector<std::vector<TestType>> runs;
+            for (int run = 0; run < meter.runs(); run++) {
+                runs.push_back(benchmarks::make_objects<TestType>(count, run * count));
+            }
+            meter.measure([&](int run) {
+                realm.write([&] {
+                    for (auto& o : runs[run]) {
+                        realm.add(std::move(o));
+                    }
+                });
+            });
+        };
+
+        BENCHMARK_ADVANCED(benchmarks::benchmark_name<TestType>("insert", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            std::vector<std::vector<TestType>> runs;
+            for (int run = 0; run < meter.runs(); run++) {
+                runs.push_back(benchmarks::make_objects<TestType>(count, run * count));
+            }
+            meter.measure([&](int run) {
+                realm.write([&] {
+                    realm.insert(std::as_const(runs[run]));
+                });
+            });
+        };
+
+        BENCHMARK_ADVANCED(benchmarks::benchmark_name<TestType>("detach", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open_with_objects<TestType>(path, count);
+            auto results = realm.objects<TestType>();
+            meter.measure([&] {
+                int64_t sum = 0;
+                for (auto& o : results) {
+                    sum += o.detach().int_col;
+                }
+                return sum;
+            });
+        };
+
+        BENCHMARK_ADVANCED(benchmarks::benchmark_name<TestType>("get", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open_with_objects<TestType>(path, count);
+            auto results = realm.objects<TestType>();
+            meter.measure([&] {
+                int64_t sum = 0;
+                for (auto& o : results) {
+                    sum += *o.int_col;
+                }
+                return sum;
+            });
+        };
+
+        BENCHMARK_ADVANCED(benchmarks::benchmark_name<TestType>("set", count))(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open_with_objects<TestType>(path, count);
+            auto results = realm.objects<TestType>();
+            meter.measure([&](int run) {
+                realm.write([&] {
+                    for (auto& o : results) {
+                        o.int_col = run;
+                    }
+                });
+            });
+        };
+    }
+}
+
+namespace {
+    template <auto Property, typename Value>
+    void benchmark_property(const std::string& type, const Value& value) {
+        BENCHMARK_ADVANCED("get " + type)(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = realm.write([&realm] {
+                return realm.add(BenchTypesObject());
+            });
+            realm.write([&] {
+                o.*Property = value;
+            });
+            meter.measure([&] {
+                return (o.*Property).detach();
+            });
+        };
+
+        BENCHMARK_ADVANCED("set " + type)(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            auto realm = benchmarks::open(path);
+            auto o = realm.write([&realm] {
+                return realm.add(BenchTypesObject());
+            });
+            // Sets are batched so the commit does not dominate the measurement.
+            realm.begin_write();
+            meter.measure([&] {
+                for (int i = 0; i < 100; i++) {
+                    o.*Property = value;
+                }
+            });
+            realm.commit_write();
+        };
+    }
+}
+
+TEST_CASE("property_benchmarks", "[benchmark]") {
+    benchmark_property<&managed<BenchTypesObject>::int_col>("int", int64_t(42));
+    benchmark_property<&managed<BenchTypesObject>::double_col>("double", 42.5);
+    benchmark_property<&managed<BenchTypesObject>::bool_col>("bool", true);
+    benchmark_property<&managed<BenchTypesObject>::str_col>("string", std::string("a string of forty characters for benches"));
+    benchmark_property<&managed<BenchTypesObject>::enum_col>("enum", BenchTypesObject::Enum::two);
+    benchmark_property<&managed<BenchTypesObject>::date_col>("date", std::chrono::system_clock::now());
+    benchmark_property<&managed<BenchTypesObject>::uuid_col>("uuid", realm::uuid());
+    benchmark_property<&managed<BenchTypesObject>::object_id_col>("object_id", realm::object_id::generate());
+    benchmark_property<&managed<BenchTypesObject>::decimal_col>("decimal", realm::decimal128(42.5));
+    benchmark_property<&managed<BenchTypesObject>::binary_col>("binary", std::vector<uint8_t>(64, 1));
+    benchmark_property<&managed<BenchTypesObject>::mixed_col>("mixed", realm::mixed(int64_t(42)));
+    benchmark_property<&managed<BenchTypesObject>::opt_int_col>("optional int", std::optional<int64_t>(42));
+    benchmark_property<&managed<BenchTypesObject>::opt_str_col>("optional string", std::optional<std::string>("optional"));
+}
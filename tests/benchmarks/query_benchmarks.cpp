@@ -0,0 +1,70 @@
+#include "../main.hpp"
+#include "benchmark_objects.hpp"
+
+using namespace realm;
+using namespace realm::experimental;
+
+TEMPLATE_TEST_CASE("query_benchmarks", "[benchmark]", BenchNarrowObject, BenchWideObject) {
+    for (auto count : benchmarks::object_counts) {
+        realm_path path;
+        auto realm = benchmarks::open_with_objects<TestType>(path, count);
+        // Matches half of the objects.
+        auto threshold = count / 2;
+
+        BENCHMARK(benchmarks::benchmark_name<TestType>("type-safe query int", count)) {
+            auto results = realm.objects<TestType>().where([threshold](auto& o) {
+                return o.int_col >= threshold;
+            });
+            return results.size();
+        };
+
+        BENCHMARK(benchmarks::benchmark_name<TestType>("string query int", count)) {
+            auto results = realm.objects<TestType>().where("int_col >= $0", {threshold});
+            return results.size();
+        };
+
+        BENCHMARK(benchmarks::benchmark_name<TestType>("type-safe query string", count)) {
+            auto results = realm.objects<TestType>().where([](auto& o) {
+                return o.str_col.contains(std::string("5"));
+            });
+            return results.size();
+        };
+
+        BENCHMARK(benchmarks::benchmark_name<TestType>("string query string", count)) {
+            auto results = realm.objects<TestType>().where("str_col CONTAINS $0", {internal::bridge::mixed(std::string("5"))});
+            return results.size();
+        };
+
+        BENCHMARK(benchmarks::benchmark_name<TestType>("type-safe query compound", count)) {
+            auto results = realm.objects<TestType>().where([threshold](auto& o) {
+                return o.int_col >= threshold && o.double_col < static_cast<double>(threshold);
+            });
+            return results.size();
+        };
+
+        BENCHMARK(benchmarks::benchmark_name<TestType>("string query compound", count)) {
+            auto results = realm.objects<TestType>().where("int_col >= $0 AND double_col < $1",
+                                                           {threshold, static_cast<double>(threshold)});
+            return results.size();
+        };
+
+        BENCHMARK(benchmarks::benchmark_name<TestType>("iterate results", count)) {
+            int64_t sum = 0;
+            for (auto& o : realm.objects<TestType>()) {
+                sum += *o.int_col;
+            }
+            return sum;
+        };
+
+        BENCHMARK(benchmarks::benchmark_name<TestType>("iterate query results", count)) {
+            auto results = realm.objects<TestType>().where([threshold](auto& o) {
+                return o.int_col >= threshold;
+            });
+            int64_t sum = 0;
+            for (auto& o : results) {
+                sum += *o.int_col;
+            }
+            return sum;
+        };
+    }
+}
@@ -0,0 +1,185 @@
+#include "../../main.hpp"
+#include "../../app_services_stand_in.hpp"
+#include <cpprealm/internal/generic_network_transport.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <future>
+#include <mutex>
+
+using namespace realm;
+
+// Tests of the app and its transports against the local App Services stand-in; sync is
+// covered by the tests in experimental/sync, which need a real server.
+
+namespace {
+    app::Request make_function_call_request(const local_http_server& server, size_t i) {
+        app::Request request;
+        request.method = app::HttpMethod::post;
+        request.url = server.url("/api/client/v2.0/app/test/functions/call");
+        request.timeout_ms = 5000;
+        request.headers = {{"Content-Type", "application/json;charset=utf-8"}};
+        request.body = "{\"name\":\"sum\",\"arguments\":[" + std::to_string(i) + "]}";
+        return request;
+    }
+}
+
+TEST_CASE("default transport") {
+    local_http_server server;
+    internal::DefaultTransport transport;
+    auto send = [&](size_t i) {
+        int status = 0;
+        transport.send_request_to_server(make_function_call_request(server, i), [&status](const app::Response& response) {
+            status = response.http_status_code;
+        });
+        return status;
+    };
+
+    SECTION("reuses an idle connection") {
+        CHECK(send(0) == 200);
+        CHECK(send(1) == 200);
+        CHECK(server.connections_accepted() == 1);
+    }
+
+    SECTION("reconnects when the server closed an idle connection") {
+        CHECK(send(0) == 200);
+        server.close_connections();
+        // A POST is not retried, so it must not be sent on the closed connection.
+        CHECK(send(1) == 200);
+        CHECK(server.connections_accepted() == 2);
+    }
+}
+
+#ifdef CPPREALM_HAVE_CURL
+TEST_CASE("curl multi transport") {
+    local_http_server server;
+    auto connections_before = server.connections_accepted();
+    internal::CurlMultiTransport transport;
+    std::atomic<int> remaining = 50;
+    std::promise<void> done;
+    std::vector<int> statuses(50);
+    for (size_t i = 0; i < 50; i++) {
+        transport.send_request_to_server(make_function_call_request(server, i), [&, i](const app::Response& response) {
+            statuses[i] = response.http_status_code;
+            if (--remaining == 0) {
+                done.set_value();
+            }
+        });
+    }
+    done.get_future().wait();
+    CHECK(transport.in_flight() == 0);
+    CHECK(std::all_of(statuses.begin(), statuses.end(), [](int s) { return s == 200; }));
+    // At most 8 connections per host by default.
+    CHECK(server.connections_accepted() - connections_before <= 8);
+}
+#endif
+
+TEST_CASE("app services stand-in") {
+    app_services_stand_in server;
+    auto base_path = std::filesystem::temp_directory_path().append("cpprealm_app_stand_in").generic_string();
+    std::filesystem::create_directories(base_path);
+    realm::App::configuration config;
+    config.app_id = "stand-in";
+    config.base_url = server.base_url();
+    config.path = base_path;
+    auto app = realm::App(config);
+
+    auto user = app.login(realm::App::credentials::anonymous()).get();
+    CHECK(user.is_logged_in());
+    auto result = user.call_function("echo", bson::BsonArray({int64_t(1), std::string("two")})).get();
+    REQUIRE(result);
+    CHECK(bson::BsonArray(*result).size() == 2);
+
+    std::filesystem::remove_all(base_path);
+}
+
+TEST_CASE("call_functions") {
+    app_services_stand_in server;
+    auto base_path = std::filesystem::temp_directory_path().append("cpprealm_call_functions").generic_string();
+    std::filesystem::create_directories(base_path);
+    realm::App::configuration config;
+    config.app_id = "stand-in";
+    config.base_url = server.base_url();
+    config.path = base_path;
+    auto app = realm::App(config);
+    auto user = app.login(realm::App::credentials::anonymous()).get();
+
+    // More calls than the window, with one failure in the middle.
+    std::vector<std::pair<std::string, bson::BsonArray>> calls;
+    for (int64_t i = 0; i < 20; i++) {
+        calls.emplace_back(i == 7 ? "fail" : "echo", bson::BsonArray({i}));
+    }
+
+    SECTION("futures") {
+        auto futures = user.call_functions(calls, 3);
+        REQUIRE(futures.size() == calls.size());
+        for (int64_t i = 0; i < static_cast<int64_t>(futures.size()); i++) {
+            if (i == 7) {
+                CHECK_THROWS_AS(futures[i].get(), app_error);
+                continue;
+            }
+            auto result = futures[i].get();
+            REQUIRE(result);
+            auto array = bson::BsonArray(*result);
+            REQUIRE(array.size() == 1);
+            CHECK(int64_t(array[0]) == i);
+        }
+    }
+
+    SECTION("callback") {
+        std::mutex mutex;
+        std::vector<size_t> completed;
+        std::vector<size_t> failed;
+        std::promise<void> done;
+        user.call_functions(calls, [&](size_t index, std::optional<bson::Bson>&& result, std::optional<app_error> err) {
+            std::lock_guard lock(mutex);
+            if (err) {
+                failed.push_back(index);
+            } else {
+                CHECK(result);
+            }
+            completed.push_back(index);
+            if (completed.size() == calls.size()) {
+                done.set_value();
+            }
+        }, 3);
+        REQUIRE(done.get_future().wait_for(std::chrono::seconds(30)) == std::future_status::ready);
+        std::sort(completed.begin(), completed.end());
+        for (size_t i = 0; i < completed.size(); i++) {
+            CHECK(completed[i] == i);
+        }
+        CHECK(failed == std::vector<size_t>({7}));
+    }
+
+    std::filesystem::remove_all(base_path);
+}
+
+#ifdef CPPREALM_HAVE_CURL
+TEST_CASE("call_functions with async transport") {
+    app_services_stand_in server;
+    auto base_path = std::filesystem::temp_directory_path().append("cpprealm_call_functions_async").generic_string();
+    std::filesystem::create_directories(base_path);
+    realm::App::configuration config;
+    config.app_id = "stand-in";
+    config.base_url = server.base_url();
+    config.path = base_path;
+    config.async_transport = true;
+    auto app = realm::App(config);
+    auto user = app.login(realm::App::credentials::anonymous()).get();
+
+    std::vector<std::pair<std::string, bson::BsonArray>> calls;
+    for (int64_t i = 0; i < 12; i++) {
+        calls.emplace_back("slow", bson::BsonArray({i}));
+    }
+    auto futures = user.call_functions(calls, 4);
+    for (int64_t i = 0; i < static_cast<int64_t>(futures.size()); i++) {
+        auto result = futures[i].get();
+        REQUIRE(result);
+        CHECK(int64_t(bson::BsonArray(*result)[0]) == i);
+    }
+    // The calls overlapped, but never beyond the window.
+    CHECK(server.peak_requests_in_flight() > 1);
+    CHECK(server.peak_requests_in_flight() <= 4);
+
+    std::filesystem::remove_all(base_path);
+}
+#endif
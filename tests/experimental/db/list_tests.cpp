@@ -366,6 +366,41 @@ TEST_CASE("list", "[list]") {
         CHECK(modifications[0] == 1);
     }
 
+    SECTION("notifications_ranges", "[list]") {
+        auto obj = realm::experimental::AllTypesObject();
+
+        auto realm = realm::experimental::db(std::move(config));
+        auto managed_obj = realm.write([&realm, &obj] {
+            return realm.add(std::move(obj));
+        });
+
+        realm::experimental::collection_change change;
+        auto token = managed_obj.list_int_col.observe([&](auto c) {
+            change = std::move(c);
+        });
+        realm.refresh();
+
+        std::vector<int64_t> values(1000, 1);
+        realm.write([&managed_obj, &values] {
+            managed_obj.list_int_col.append(values.begin(), values.end());
+        });
+        realm.refresh();
+
+        using range = realm::experimental::index_ranges::range;
+        CHECK(change.insertions.ranges() == std::vector<range>({{0, 1000}}));
+        CHECK(change.insertions.size() == 1000);
+        CHECK(change.insertions[999] == 999);
+        uint64_t expected = 0;
+        bool in_order = true;
+        for (auto index : change.insertions) {
+            in_order &= index == expected++;
+        }
+        CHECK(in_order);
+        CHECK(expected == 1000);
+        std::vector<uint64_t> as_vector = change.insertions;
+        CHECK(as_vector.size() == 1000);
+    }
+
     SECTION("list_all_primitive_types") {
         auto realm = realm::experimental::db(std::move(config));
         using Enum = realm::experimental::AllTypesObject::Enum;
@@ -466,6 +501,69 @@ TEST_CASE("list", "[list]") {
         CHECK(as_value == std::vector<int64_t>{1, 2, 3});
     }
 
+    SECTION("bulk operations") {
+        auto realm = realm::experimental::db(std::move(config));
+        auto obj = realm::experimental::AllTypesObject();
+        auto managed_obj = realm.write([&]() {
+            return realm.add(std::move(obj));
+        });
+
+        std::vector<int64_t> samples = {1, 2, 3, 4, 5};
+        realm.write([&]() {
+            managed_obj.list_int_col.append(samples.begin(), samples.end());
+        });
+        CHECK(managed_obj.list_int_col.detach() == samples);
+
+        realm.write([&]() {
+            managed_obj.list_int_col.insert(1, std::vector<int64_t>{10, 11});
+        });
+        CHECK(managed_obj.list_int_col.detach() == std::vector<int64_t>({1, 10, 11, 2, 3, 4, 5}));
+
+        realm.write([&]() {
+            managed_obj.list_int_col.erase(1, 3);
+        });
+        CHECK(managed_obj.list_int_col.detach() == samples);
+
+        realm.write([&]() {
+            managed_obj.list_int_col.assign(std::vector<int64_t>{7, 8});
+        });
+        CHECK(managed_obj.list_int_col.detach() == std::vector<int64_t>({7, 8}));
+
+        std::vector<int64_t> out;
+        out.reserve(16);
+        auto data = out.data();
+        managed_obj.list_int_col.detach_into(out);
+        CHECK(out == std::vector<int64_t>({7, 8}));
+        CHECK(out.data() == data);
+
+        realm.write([&]() {
+            managed_obj.list_str_col.assign({"a", "b", "c"});
+            managed_obj.list_str_col.erase(managed_obj.list_str_col.begin(), managed_obj.list_str_col.end());
+        });
+        CHECK(managed_obj.list_str_col.size() == 0);
+
+        std::vector<realm::mixed> mixed_values = {(int64_t)1, std::string("foo")};
+        realm.write([&]() {
+            managed_obj.list_mixed_col.append(mixed_values.begin(), mixed_values.end());
+        });
+        CHECK(managed_obj.list_mixed_col.detach() == mixed_values);
+
+        auto other = realm.write([&]() {
+            return realm.add(realm::experimental::AllTypesObject());
+        });
+        realm.write([&]() {
+            other.list_int_col.append(managed_obj.list_int_col.begin(), managed_obj.list_int_col.end());
+            other.list_int_col.append(other.list_int_col.begin(), other.list_int_col.end());
+        });
+        CHECK(other.list_int_col.detach() == std::vector<int64_t>({7, 8, 7, 8}));
+        realm.write([&]() {
+            other.list_int_col.assign(managed_obj.list_int_col);
+            other.list_str_col.insert(0, managed_obj.list_str_col);
+        });
+        CHECK(other.list_int_col.detach() == std::vector<int64_t>({7, 8}));
+        CHECK(other.list_str_col.size() == 0);
+    }
+
     SECTION("iterator") {
         auto realm = realm::experimental::db(std::move(config));
         auto obj = realm::experimental::AllTypesObject();
@@ -207,4 +207,70 @@ TEST_CASE("map", "[map]") {
         std::map<std::string, std::string> as_values = managed_obj.map_str_col.detach();
         CHECK(as_values == std::map<std::string, std::string>({{"a", std::string("baz")}, {"b", std::string("foo")}}));
     }
+
+    SECTION("string_view_lookup_and_bulk_insert") {
+        auto obj = experimental::AllTypesObject();
+        auto realm = experimental::db(std::move(config));
+        auto managed_obj = realm.write([&realm, &obj] {
+            return realm.add(std::move(obj));
+        });
+
+        std::map<std::string, int64_t> values = {{"a", 1}, {"b", 2}, {"c", 3}};
+        realm.write([&] {
+            managed_obj.map_int_col.insert(values);
+            managed_obj.map_int_col.insert(std::vector<std::pair<std::string, int64_t>>({{"c", 4}, {"d", 5}}));
+        });
+        CHECK(managed_obj.map_int_col.size() == 4);
+        CHECK(managed_obj.map_int_col.detach() == std::map<std::string, int64_t>({{"a", 1}, {"b", 2}, {"c", 4}, {"d", 5}}));
+
+        // Yields each pair by value, so the keys do not outlive the dereference.
+        struct generating_iterator {
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::pair<std::string, int64_t>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            value_type operator*() const {
+                return {"a_key_that_does_not_fit_in_the_small_string_buffer_" + std::to_string(i), i};
+            }
+            generating_iterator& operator++() {
+                ++i;
+                return *this;
+            }
+            bool operator!=(const generating_iterator& other) const {
+                return i != other.i;
+            }
+            int64_t i;
+        };
+        realm.write([&] {
+            managed_obj.map_int_col.insert(generating_iterator{0}, generating_iterator{8});
+        });
+        CHECK(managed_obj.map_int_col.size() == 12);
+        CHECK(managed_obj.map_int_col["a_key_that_does_not_fit_in_the_small_string_buffer_0"] == 0);
+        CHECK(managed_obj.map_int_col["a_key_that_does_not_fit_in_the_small_string_buffer_7"] == 7);
+        realm.write([&] {
+            for (int64_t i = 0; i < 8; i++) {
+                managed_obj.map_int_col.erase("a_key_that_does_not_fit_in_the_small_string_buffer_" + std::to_string(i));
+            }
+        });
+
+        std::string_view key = "b";
+        CHECK(managed_obj.map_int_col.contains(key));
+        CHECK_FALSE(managed_obj.map_int_col.contains("z"));
+        CHECK(managed_obj.map_int_col[key] == 2);
+        CHECK(managed_obj.map_int_col.find(key) != managed_obj.map_int_col.end());
+        CHECK(managed_obj.map_int_col.find(std::string_view("z")) == managed_obj.map_int_col.end());
+
+        std::map<std::string, int64_t> iterated;
+        for (auto it = managed_obj.map_int_col.begin(); it != managed_obj.map_int_col.end(); ++it) {
+            iterated.emplace(std::string(it.key()), it.value());
+        }
+        CHECK(iterated == managed_obj.map_int_col.detach());
+
+        realm.write([&] {
+            managed_obj.map_int_col.erase(key);
+        });
+        CHECK_FALSE(managed_obj.map_int_col.contains(key));
+    }
 }
@@ -668,6 +668,95 @@ namespace realm::experimental {
             CHECK(run_count == 2);
         }
 
+        SECTION("object_notifications_key_paths") {
+            auto realm = db(std::move(config));
+            Person person;
+            person._id = 1;
+            person.name = "John";
+            Dog dog;
+            dog._id = 1;
+            dog.name = "fido";
+            person.dog = &dog;
+            auto managed_person = realm.write([&] {
+                return realm.add(std::move(person));
+            });
+
+            int run_count = 0;
+            std::vector<std::string> changed;
+            auto token = managed_person.observe([&](auto&& change) {
+                run_count++;
+                changed.clear();
+                for (auto& prop_change : change.property_changes) {
+                    changed.push_back(prop_change.name);
+                }
+            }, {"name", "dog.name"});
+
+            realm.write([&] {
+                managed_person.age = 42;
+            });
+            realm.refresh();
+            CHECK(run_count == 0);
+
+            realm.write([&] {
+                managed_person.name = "Jane";
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+            CHECK(changed == std::vector<std::string>({"name"}));
+
+            realm.write([&] {
+                managed_person.dog->age = 3;
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+
+            realm.write([&] {
+                managed_person.dog->name = "rex";
+            });
+            realm.refresh();
+            CHECK(run_count == 2);
+
+            CHECK_THROWS_AS(managed_person.observe([](auto&&) {}, {"not_a_property"}), std::invalid_argument);
+            CHECK_THROWS_AS(managed_person.observe([](auto&&) {}, {"name.length"}), std::invalid_argument);
+            // Backlinks are computed properties without a column of their own, so key paths
+            // through them are not supported.
+            auto managed_dog = realm.objects<Dog>()[0];
+            CHECK_THROWS_AS(managed_dog.observe([](auto&&) {}, {"owners.name"}), std::invalid_argument);
+        }
+
+        SECTION("object_notifications_key_paths_through_collections") {
+            auto realm = db(std::move(config));
+            AllTypesObjectLink link;
+            link._id = 1;
+            link.str_col = "foo";
+            AllTypesObject obj;
+            obj._id = 1;
+            obj.list_obj_col.push_back(&link);
+            auto managed_obj = realm.write([&] {
+                return realm.add(std::move(obj));
+            });
+
+            int run_count = 0;
+            auto token = managed_obj.observe([&](auto&&) {
+                run_count++;
+            }, {"list_obj_col.str_col"});
+
+            realm.write([&] {
+                managed_obj.str_col = "changed";
+            });
+            realm.refresh();
+            CHECK(run_count == 0);
+
+            realm.write([&] {
+                realm.objects<AllTypesObjectLink>()[0].str_col = "bar";
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+
+            CHECK_NOTHROW(managed_obj.observe([](auto&&) {}, {"set_obj_col.str_col"}));
+            CHECK_NOTHROW(managed_obj.observe([](auto&&) {}, {"map_link_col.str_link_col.str_col"}));
+        }
+
         SECTION("optional objects") {
             auto realm = db(std::move(config));
 
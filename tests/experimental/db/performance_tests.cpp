@@ -1,6 +1,13 @@
 #include "../../main.hpp"
 #include "test_objects.hpp"
 
+#ifdef CPPREALM_HAVE_CURL
+#include "../../app_services_stand_in.hpp"
+#include <cpprealm/internal/generic_network_transport.hpp>
+#include <filesystem>
+#include <future>
+#endif
+
 using namespace realm;
 
 TEST_CASE("basic_beta_performance", "[performance]") {
@@ -87,3 +94,209 @@ TEST_CASE("basic_beta_performance", "[performance]") {
         });
     };
 }
+
+TEST_CASE("map_performance", "[performance]") {
+    BENCHMARK_ADVANCED("map bulk insert 100000")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = experimental::db(std::move(config));
+        auto managed_obj = realm.write([&] {
+            return realm.add(experimental::AllTypesObject());
+        });
+
+        std::vector<std::pair<std::string, int64_t>> values;
+        values.reserve(100000);
+        for (int64_t i = 0; i < 100000; i++) {
+            values.emplace_back("key_" + std::to_string(i), i);
+        }
+
+        meter.measure([&]() {
+            realm.write([&] {
+                managed_obj.map_int_col.insert(values);
+            });
+        });
+        CHECK(managed_obj.map_int_col.size() == 100000);
+    };
+
+    BENCHMARK_ADVANCED("map lookup 100000")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = experimental::db(std::move(config));
+        auto managed_obj = realm.write([&] {
+            return realm.add(experimental::AllTypesObject());
+        });
+
+        std::vector<std::pair<std::string, int64_t>> values;
+        values.reserve(100000);
+        for (int64_t i = 0; i < 100000; i++) {
+            values.emplace_back("key_" + std::to_string(i), i);
+        }
+        realm.write([&] {
+            managed_obj.map_int_col.insert(values);
+        });
+
+        meter.measure([&]() {
+            size_t found = 0;
+            for (auto& [k, v] : values) {
+                if (managed_obj.map_int_col.contains(std::string_view(k))) {
+                    found++;
+                }
+            }
+            return found;
+        });
+    };
+
+    BENCHMARK_ADVANCED("map iterate 100000")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = experimental::db(std::move(config));
+        auto managed_obj = realm.write([&] {
+            return realm.add(experimental::AllTypesObject());
+        });
+
+        std::vector<std::pair<std::string, int64_t>> values;
+        values.reserve(100000);
+        for (int64_t i = 0; i < 100000; i++) {
+            values.emplace_back("key_" + std::to_string(i), i);
+        }
+        realm.write([&] {
+            managed_obj.map_int_col.insert(values);
+        });
+
+        meter.measure([&]() {
+            int64_t sum = 0;
+            size_t key_bytes = 0;
+            for (auto it = managed_obj.map_int_col.begin(), end = managed_obj.map_int_col.end(); it != end; ++it) {
+                key_bytes += it.key().size();
+                sum += it.value();
+            }
+            return sum + static_cast<int64_t>(key_bytes);
+        });
+    };
+}
+
+#ifdef CPPREALM_HAVE_CURL
+namespace {
+    app::Request make_function_call_request(const local_http_server& server, size_t i) {
+        app::Request request;
+        request.method = app::HttpMethod::post;
+        request.url = server.url("/api/client/v2.0/app/test/functions/call");
+        request.timeout_ms = 5000;
+        request.headers = {{"Content-Type", "application/json;charset=utf-8"}};
+        request.body = "{\"name\":\"sum\",\"arguments\":[" + std::to_string(i) + "]}";
+        return request;
+    }
+}
+
+TEST_CASE("transport_performance", "[performance]") {
+    local_http_server server;
+
+    BENCHMARK("default transport 100 sequential requests") {
+        internal::DefaultTransport transport;
+        int ok = 0;
+        for (size_t i = 0; i < 100; i++) {
+            transport.send_request_to_server(make_function_call_request(server, i), [&ok](const app::Response& response) {
+                ok += response.http_status_code == 200;
+            });
+        }
+        return ok;
+    };
+
+    BENCHMARK("curl multi transport 100 concurrent requests") {
+        internal::CurlMultiTransport transport;
+        std::atomic<int> remaining = 100;
+        std::atomic<int> ok = 0;
+        std::promise<void> done;
+        for (size_t i = 0; i < 100; i++) {
+            transport.send_request_to_server(make_function_call_request(server, i), [&](const app::Response& response) {
+                ok += response.http_status_code == 200;
+                if (--remaining == 0) {
+                    done.set_value();
+                }
+            });
+        }
+        done.get_future().wait();
+        return ok.load();
+    };
+}
+
+TEST_CASE("app_performance", "[performance]") {
+    app_services_stand_in server;
+    auto base_path = std::filesystem::temp_directory_path().append("cpprealm_app_performance").generic_string();
+    std::filesystem::create_directories(base_path);
+    realm::App::configuration config;
+    config.app_id = "stand-in";
+    config.base_url = server.base_url();
+    config.path = base_path;
+    auto app = realm::App(config);
+
+    BENCHMARK("login") {
+        return app.login(realm::App::credentials::anonymous()).get();
+    };
+
+    auto user = app.login(realm::App::credentials::anonymous()).get();
+    BENCHMARK("call_function") {
+        return user.call_function("echo", bson::BsonArray({int64_t(42)})).get();
+    };
+
+    std::vector<std::pair<std::string, bson::BsonArray>> calls;
+    for (int64_t i = 0; i < 100; i++) {
+        calls.emplace_back("echo", bson::BsonArray({i}));
+    }
+    BENCHMARK("call_function 100 sequential") {
+        for (auto& [name, args] : calls) {
+            user.call_function(name, args).get();
+        }
+    };
+
+    BENCHMARK("call_functions 100 batched") {
+        for (auto& f : user.call_functions(calls, 16)) {
+            f.get();
+        }
+    };
+
+    BENCHMARK("DefaultTransport request") {
+        internal::DefaultTransport transport;
+        app::Request request;
+        request.method = app::HttpMethod::get;
+        request.url = server.base_url() + "/api/client/v2.0/app/stand-in/location";
+        request.timeout_ms = 5000;
+        std::promise<int> status;
+        transport.send_request_to_server(request, [&status](const app::Response& response) {
+            status.set_value(response.http_status_code);
+        });
+        return status.get_future().get();
+    };
+
+    std::filesystem::remove_all(base_path);
+}
+
+#endif
+
+TEST_CASE("logger_performance", "[performance]") {
+    struct null_logger : public logger {
+        void do_log(level, const std::string&) override {}
+    };
+
+    async_logger log(std::make_shared<null_logger>(), 1 << 16, async_logger::overflow_policy::block);
+    log.set_level_threshold(logger::level::info);
+    for (auto level : {logger::level::trace, logger::level::debug, logger::level::info, logger::level::warn}) {
+        auto name = std::string("async_logger 10000 calls at level ") + std::to_string(static_cast<int>(level));
+        BENCHMARK(std::move(name)) {
+            for (int i = 0; i < 10000; i++) {
+                log.log(level, "object %1 changed in table %2", i, "AllTypesObject");
+            }
+            log.flush();
+        };
+    }
+
+    BENCHMARK("synchronous logger 10000 formatted calls") {
+        null_logger sink;
+        for (int i = 0; i < 10000; i++) {
+            sink.do_log(logger::level::info, util::format("object %1 changed in table %2", i, "AllTypesObject"));
+        }
+    };
+}
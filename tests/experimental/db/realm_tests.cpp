@@ -1,6 +1,12 @@
 #include "test_objects.hpp"
 #include "../../main.hpp"
 #include <realm/object-store/shared_realm.hpp>
+#include <realm/util/logger.hpp>
+#include <realm/version_numbers.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <sstream>
 
 namespace realm::experimental {
 
@@ -76,4 +82,418 @@ namespace realm::experimental {
         config2.set_path(path);
         REQUIRE_THROWS(experimental::db(config2));
     }
-}
\ No newline at end of file
+
+    TEST_CASE("thread pool executor") {
+        realm_path path;
+        thread_pool_executor executor(4);
+        CHECK(executor.size() == 4);
+
+        SECTION("submit") {
+            std::vector<std::future<int>> futures;
+            for (int i = 0; i < 1000; i++) {
+                futures.push_back(executor.submit([i] { return i; }));
+            }
+            int sum = 0;
+            for (auto& f : futures) {
+                sum += f.get();
+            }
+            CHECK(sum == 999 * 1000 / 2);
+        }
+
+        SECTION("nested posts are stolen") {
+            std::atomic<int> count = 0;
+            std::promise<void> done;
+            executor.post([&] {
+                for (int i = 0; i < 100; i++) {
+                    executor.post([&] {
+                        if (++count == 100) {
+                            done.set_value();
+                        }
+                    });
+                }
+            });
+            done.get_future().wait();
+            CHECK(count == 100);
+        }
+
+        SECTION("move-only work") {
+            auto value = std::make_unique<int>(42);
+            auto future = executor.submit([value = std::move(value)] { return *value; });
+            CHECK(future.get() == 42);
+
+            std::promise<int> posted;
+            executor.post([value = std::make_unique<int>(7), &posted] { posted.set_value(*value); });
+            CHECK(posted.get_future().get() == 7);
+        }
+
+#if defined(__linux__)
+        SECTION("completion on target scheduler") {
+            auto target = std::make_shared<realm::event_loop_scheduler>();
+            bool completed = false;
+            executor.submit([value = std::make_unique<int>(5)] { return std::make_unique<int>(*value * 2); },
+                            target, [&completed, target](std::unique_ptr<int> result) {
+                CHECK(target->is_on_thread());
+                CHECK(*result == 10);
+                completed = true;
+            });
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!completed && std::chrono::steady_clock::now() < deadline) {
+                target->run_once(std::chrono::milliseconds(10));
+            }
+            CHECK(completed);
+        }
+#endif
+
+        SECTION("frozen snapshot") {
+            auto config = realm::db_config();
+            config.set_path(path);
+            auto realm = db(std::move(config));
+            realm.write([&realm] {
+                for (int64_t i = 0; i < 10; i++) {
+                    AllTypesObject o;
+                    o._id = i;
+                    realm.add(std::move(o));
+                }
+            });
+            auto future = executor.submit_frozen(realm, [](db& frozen) {
+                CHECK(frozen.is_frozen());
+                return frozen.objects<AllTypesObject>().size();
+            });
+            CHECK(future.get() == 10);
+            CHECK_FALSE(realm.is_frozen());
+        }
+    }
+
+    TEST_CASE("realm metrics") {
+        realm_path path;
+        auto config = realm::db_config();
+        config.set_path(path);
+        auto file = config.path();
+        auto metrics = realm_metrics::enable(file);
+        config.set_scheduler(std::make_shared<instrumented_scheduler>(scheduler::make_default(), metrics));
+        auto realm = db(std::move(config));
+
+        auto results = realm.objects<AllTypesObject>();
+        int callback_count = 0;
+        auto token = results.observe([&](auto&&) {
+            callback_count++;
+        });
+        // A second observer of the same commit must not record a second sample.
+        auto second_token = results.observe([&](auto&&) {
+            callback_count++;
+        });
+        realm.refresh();
+        realm.write([&realm] {
+            AllTypesObject o;
+            o._id = 1;
+            realm.add(std::move(o));
+        });
+        realm.refresh();
+
+        CHECK(callback_count == 4);
+        CHECK(metrics->handler_duration.get_snapshot().count == 4);
+        auto commit_to_notify = metrics->commit_to_notify.get_snapshot();
+        CHECK(commit_to_notify.count == 1);
+        CHECK(commit_to_notify.percentile(100) >= commit_to_notify.percentile(50));
+        CHECK_FALSE(metrics->to_string().empty());
+        realm_metrics::disable(file);
+        CHECK(realm_metrics::find(file) == nullptr);
+    }
+
+    TEST_CASE("latency histogram") {
+        latency_histogram histogram;
+        for (uint64_t i = 1; i <= 1000; i++) {
+            histogram.record(i);
+        }
+        auto snapshot = histogram.get_snapshot();
+        CHECK(snapshot.count == 1000);
+        CHECK(snapshot.max == 1000);
+        CHECK(snapshot.mean() == 500.5);
+        CHECK(snapshot.percentile(50) == 512);
+        CHECK(snapshot.percentile(100) == 1000);
+        histogram.reset();
+        CHECK(histogram.get_snapshot().count == 0);
+    }
+
+    TEST_CASE("db metrics") {
+        realm_path path;
+        auto config = realm::db_config();
+        config.set_path(path);
+        auto realm = db(std::move(config));
+        auto metrics = realm.metrics();
+        CHECK(metrics == realm_metrics::find(realm.m_realm.path()));
+
+        realm.write([&realm] {
+            AllTypesObject o;
+            o._id = 1;
+            realm.add(std::move(o));
+            std::vector<AllTypesObject> objects(2);
+            objects[0]._id = 2;
+            objects[1]._id = 3;
+            realm.insert(std::as_const(objects));
+        });
+        auto results = realm.objects<AllTypesObject>().where([](auto& o) {
+            return o._id > 1;
+        });
+        CHECK(results.size() == 2);
+        realm.refresh();
+        auto frozen = realm.freeze();
+
+        auto snapshot = realm.metrics()->get_snapshot();
+        CHECK(snapshot.write_transactions == 1);
+        CHECK(snapshot.commits == 1);
+        CHECK(snapshot.commit_duration.count == 1);
+        CHECK(snapshot.commit_size.count == 1);
+        CHECK(snapshot.commit_size.sum > 0);
+        CHECK(snapshot.objects_created == 3);
+        CHECK(snapshot.query_executions == 1);
+        CHECK(snapshot.query_duration.count == 1);
+        CHECK(snapshot.refreshes == 1);
+        CHECK(snapshot.freezes == 1);
+        CHECK(snapshot.active_versions >= 1);
+
+        auto text = realm_metrics::render_prometheus({{"a\"b", snapshot}});
+        CHECK(text.find("# TYPE realm_commits_total counter\nrealm_commits_total{path=\"a\\\"b\"} 1\n") != std::string::npos);
+        CHECK(text.find("realm_objects_created_total{path=\"a\\\"b\"} 3\n") != std::string::npos);
+        CHECK(text.find("realm_query_duration_nanoseconds_bucket{path=\"a\\\"b\",le=\"+Inf\"} 1\n") != std::string::npos);
+        CHECK(text.find("realm_commit_size_bytes_count{path=\"a\\\"b\"} 1\n") != std::string::npos);
+        CHECK(realm_metrics::render_prometheus().find(realm.m_realm.path()) != std::string::npos);
+        realm_metrics::disable(realm.m_realm.path());
+    }
+
+    TEST_CASE("async logger") {
+        struct recording_logger : public logger {
+            void do_log(level l, const std::string& message) override {
+                {
+                    std::lock_guard lock(mutex);
+                    messages.emplace_back(l, message);
+                }
+                if (block) {
+                    // Hold up the flusher so the buffer fills.
+                    std::unique_lock release_lock(release_mutex);
+                    blocked = true;
+                    released.wait(release_lock, [this] { return !block; });
+                }
+            }
+            std::mutex mutex;
+            std::vector<std::pair<level, std::string>> messages;
+            std::mutex release_mutex;
+            std::condition_variable released;
+            std::atomic<bool> block = false;
+            std::atomic<bool> blocked = false;
+        };
+
+        SECTION("delivers messages in order above the threshold") {
+            auto sink = std::make_shared<recording_logger>();
+            async_logger log(sink);
+            log.set_level_threshold(logger::level::info);
+            log.do_log(logger::level::info, "one");
+            log.log(logger::level::warn, "%1 and %2", 2, std::string("two"));
+            log.do_log(logger::level::debug, "filtered");
+            log.flush();
+            REQUIRE(sink->messages.size() == 2);
+            CHECK(sink->messages[0] == std::make_pair(logger::level::info, std::string("one")));
+            CHECK(sink->messages[1] == std::make_pair(logger::level::warn, std::string("2 and two")));
+        }
+
+        SECTION("copies borrowed strings") {
+            auto sink = std::make_shared<recording_logger>();
+            async_logger log(sink);
+            {
+                std::string temporary = "temporary";
+                log.log(logger::level::info, "%1 %2", temporary.c_str(), std::string_view(temporary));
+                temporary.assign(temporary.size(), 'x');
+            }
+            log.flush();
+            REQUIRE(sink->messages.size() == 1);
+            CHECK(sink->messages[0].second == "temporary temporary");
+        }
+
+        SECTION("drops when full") {
+            auto sink = std::make_shared<recording_logger>();
+            sink->block = true;
+            {
+                async_logger log(sink, 4);
+                log.do_log(logger::level::info, "blocks the flusher");
+                // Wait for the flusher to be held up by the first message.
+                while (!sink->blocked) {
+                    std::this_thread::yield();
+                }
+                for (int i = 0; i < 10; i++) {
+                    log.log(logger::level::info, "%1", i);
+                }
+                // The message held by the sink still occupies its slot, leaving three free.
+                CHECK(log.dropped() == 7);
+                {
+                    std::lock_guard lock(sink->release_mutex);
+                    sink->block = false;
+                }
+                sink->released.notify_all();
+            }
+            CHECK(sink->messages.size() == 4);
+        }
+    }
+
+    TEST_CASE("log categories") {
+        auto default_level = get_log_level(log_category::realm);
+        set_log_level(log_category::sync_client, logger::level::debug);
+        CHECK(get_log_level(log_category::sync_client) == logger::level::debug);
+        CHECK(get_log_level(log_category::sync_client_session) == logger::level::debug);
+        CHECK(get_log_level(log_category::sync) == default_level);
+        CHECK(get_log_level(log_category::storage) == default_level);
+        set_log_level(log_category::sync_client_network, logger::level::trace);
+        CHECK(get_log_level(log_category::sync_client_network) == logger::level::trace);
+        CHECK(get_log_level(log_category::sync_client_session) == logger::level::debug);
+        reset_log_level(log_category::sync_client);
+        reset_log_level(log_category::sync_client_network);
+        CHECK(get_log_level(log_category::sync_client_network) == default_level);
+
+        struct record_logger : public logger {
+            void log(const record& r) override {
+                category = r.category;
+                thread_id = r.thread_id;
+                message = r.message;
+            }
+            std::string category;
+            std::string message;
+            std::thread::id thread_id;
+        };
+        auto sink = std::make_shared<record_logger>();
+        {
+            async_logger log(sink);
+            log.do_log(logger::level::error, "structured");
+        }
+        CHECK(sink->category == log_category::sdk);
+        CHECK(sink->message == "structured");
+        CHECK(sink->thread_id == std::this_thread::get_id());
+    }
+
+    TEST_CASE("log category filtering") {
+        struct capture_logger : public logger {
+            void log(const record& r) override {
+                std::lock_guard lock(mutex);
+                records.emplace_back(std::string(r.category), std::string(r.message));
+            }
+            std::mutex mutex;
+            std::vector<std::pair<std::string, std::string>> records;
+        };
+        auto previous_logger = util::Logger::get_default_logger();
+        auto previous_level = get_log_level(log_category::realm);
+        set_default_level_threshold(logger::level::warn);
+        set_log_level(log_category::sync_client_session, logger::level::debug);
+        // The database checks a single threshold, the most verbose of any category.
+        CHECK(util::Logger::get_default_level_threshold() == util::Logger::Level::debug);
+
+        auto sink = std::make_shared<capture_logger>();
+        set_default_logger(std::shared_ptr<logger>(sink));
+        auto core_logger = util::Logger::get_default_logger();
+#if REALM_VERSION_MAJOR < 14
+        core_logger->log(util::Logger::Level::debug, "Connection[1]: Session[1]: Received: DOWNLOAD");
+        core_logger->log(util::Logger::Level::debug, "Connection[1]: Connected to endpoint");
+        core_logger->log(util::Logger::Level::debug, "Opened realm file");
+        core_logger->log(util::Logger::Level::warn, "Connection[1]: Connection closed");
+
+        // Not reported by this database, so the threshold is ignored.
+        set_log_level(log_category::storage, logger::level::trace);
+        CHECK(get_log_level(log_category::storage) == logger::level::warn);
+#else
+        core_logger->log(util::LogCategory::session, util::Logger::Level::debug, "Connection[1]: Session[1]: Received: DOWNLOAD");
+        core_logger->log(util::LogCategory::network, util::Logger::Level::debug, "Connection[1]: Connected to endpoint");
+        core_logger->log(util::LogCategory::storage, util::Logger::Level::debug, "Opened realm file");
+        core_logger->log(util::LogCategory::network, util::Logger::Level::warn, "Connection[1]: Connection closed");
+#endif
+        CHECK(sink->records == std::vector<std::pair<std::string, std::string>>({
+                {log_category::sync_client_session, "Connection[1]: Session[1]: Received: DOWNLOAD"},
+                {log_category::sync_client_network, "Connection[1]: Connection closed"}}));
+
+        reset_log_level(log_category::sync_client_session);
+        set_default_level_threshold(previous_level);
+        util::Logger::set_default_logger(previous_logger);
+    }
+
+    TEST_CASE("file stats") {
+        realm_path path;
+        auto config = realm::db_config();
+        config.set_path(path);
+        auto realm = db(std::move(config));
+        realm.write([&realm] {
+            for (int64_t i = 0; i < 100; i++) {
+                AllTypesObject o;
+                o._id = i;
+                realm.add(std::move(o));
+            }
+        });
+
+        auto stats = realm.file_stats(true);
+        CHECK(stats.file_size > 0);
+        CHECK(stats.used_size > 0);
+        CHECK(stats.used_size + stats.free_size <= stats.file_size);
+        CHECK(stats.oldest_version <= stats.latest_version);
+        auto table = std::find_if(stats.tables.begin(), stats.tables.end(), [](auto& t) {
+            return t.name == "AllTypesObject";
+        });
+        REQUIRE(table != stats.tables.end());
+        CHECK(table->object_count == 100);
+        CHECK(table->size > 0);
+        auto cheap = realm.file_stats();
+        CHECK(cheap.tables.size() == stats.tables.size());
+        CHECK(std::all_of(cheap.tables.begin(), cheap.tables.end(), [](auto& t) { return t.size == 0; }));
+
+        // A frozen realm pins its version while later commits are made.
+        auto frozen = realm.freeze();
+        auto pinned = frozen.file_stats().latest_version;
+        auto obj = realm.objects<AllTypesObject>()[0];
+        for (int64_t i = 0; i < 3; i++) {
+            realm.write([&obj, i] {
+                obj.int_col = i;
+            });
+        }
+        stats = realm.file_stats();
+        CHECK(stats.latest_version >= pinned + 3);
+        CHECK(stats.oldest_version <= pinned);
+        CHECK(stats.version_count >= 4);
+    }
+
+    TEST_CASE("tracing") {
+        realm_path path;
+        auto config = realm::db_config();
+        config.set_path(path);
+        auto realm = db(std::move(config));
+
+        tracing::clear();
+        tracing::start();
+        realm.write([&realm] {
+            AllTypesObject o;
+            o._id = 1;
+            realm.add(std::move(o));
+        });
+        auto results = realm.objects<AllTypesObject>().where([](auto& o) {
+            return o._id == 1;
+        });
+        CHECK(results.size() == 1);
+        tracing::stop();
+        realm.write([] {});
+
+        std::ostringstream out;
+        tracing::write_chrome_trace(out);
+        auto trace = out.str();
+        CHECK(trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0);
+        auto count = [&trace](const std::string& name) {
+            size_t n = 0;
+            for (auto pos = trace.find(name); pos != std::string::npos; pos = trace.find(name, pos + 1)) {
+                n++;
+            }
+            return n;
+        };
+        if constexpr (tracing::compiled_in) {
+            CHECK(count("\"name\":\"db::write\"") == 1);
+            CHECK(count("\"name\":\"commit\"") == 1);
+            CHECK(count("\"name\":\"query\"") == 1);
+            CHECK(trace.find("\"ph\":\"X\"") != std::string::npos);
+        } else {
+            CHECK(count("\"ph\"") == 0);
+            CHECK_FALSE(tracing::is_recording());
+        }
+        tracing::clear();
+    }
+}
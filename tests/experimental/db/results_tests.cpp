@@ -160,6 +160,157 @@ namespace realm::experimental {
             CHECK(did_run);
         }
 
+        SECTION("results_notifications_key_paths") {
+            auto realm = db(std::move(config));
+
+            AllTypesObject obj;
+            obj._id = 1;
+            AllTypesObjectLink link;
+            link.str_col = "foo";
+            obj.opt_obj_col = &link;
+            auto managed_obj = realm.write([&realm, &obj]() {
+                return realm.add(std::move(obj));
+            });
+
+            int callback_count = 0;
+            results<AllTypesObject>::results_change change;
+            auto results = realm.objects<AllTypesObject>();
+            auto token = results.observe([&](auto&& c) {
+                callback_count++;
+                change = std::move(c);
+            }, {"str_col", "opt_obj_col.str_col"});
+            realm.refresh();
+            callback_count = 0;
+
+            realm.write([&managed_obj] {
+                managed_obj.double_col = 42.0;
+            });
+            realm.refresh();
+            CHECK(callback_count == 0);
+
+            realm.write([&managed_obj] {
+                managed_obj.str_col = "bar";
+            });
+            realm.refresh();
+            CHECK(callback_count == 1);
+            CHECK(change.modifications.size() == 1);
+
+            realm.write([&managed_obj] {
+                managed_obj.opt_obj_col->str_col = "baz";
+            });
+            realm.refresh();
+            CHECK(callback_count == 2);
+            CHECK(change.modifications.size() == 1);
+
+            CHECK_THROWS_AS(results.observe([](auto&&) {}, {"not_a_property"}), std::invalid_argument);
+            CHECK_THROWS_AS(results.observe([](auto&&) {}, {"str_col.length"}), std::invalid_argument);
+        }
+
+        SECTION("results_notifications_coalesced") {
+            auto realm = db(std::move(config));
+
+            int callback_count = 0;
+            results<AllTypesObject>::results_change change;
+            auto results = realm.objects<AllTypesObject>();
+            notification_options options;
+            options.max_pending_commits = 3;
+            auto token = results.observe([&](auto&& c) {
+                callback_count++;
+                change = std::move(c);
+            }, options);
+            realm.refresh();
+            CHECK(callback_count == 1);
+
+            for (int64_t i = 1; i <= 3; i++) {
+                realm.write([&realm, i] {
+                    AllTypesObject o;
+                    o._id = i;
+                    realm.add(std::move(o));
+                });
+                realm.refresh();
+            }
+
+            CHECK(callback_count == 2);
+            CHECK(change.insertions == std::vector<uint64_t>({0, 1, 2}));
+            CHECK(change.collection->size() == 3);
+        }
+
+#if defined(__linux__)
+        SECTION("results_notifications_min_interval") {
+            auto scheduler = std::make_shared<realm::event_loop_scheduler>();
+            auto realm = db(db_config(path, scheduler));
+
+            int callback_count = 0;
+            results<AllTypesObject>::results_change change;
+            auto results = realm.objects<AllTypesObject>();
+            notification_options options;
+            options.min_interval = std::chrono::milliseconds(100);
+            auto token = results.observe([&](auto&& c) {
+                callback_count++;
+                change = std::move(c);
+            }, options);
+            auto before_initial = std::chrono::steady_clock::now();
+            realm.refresh();
+            CHECK(callback_count == 1);
+
+            for (int64_t i = 1; i <= 3; i++) {
+                realm.write([&realm, i] {
+                    AllTypesObject o;
+                    o._id = i;
+                    realm.add(std::move(o));
+                });
+                realm.refresh();
+            }
+            CHECK(callback_count == 1);
+
+            while (callback_count < 2 && std::chrono::steady_clock::now() - before_initial < std::chrono::seconds(5)) {
+                scheduler->run_once(std::chrono::milliseconds(10));
+            }
+            CHECK(callback_count == 2);
+            CHECK(std::chrono::steady_clock::now() - before_initial >= options.min_interval);
+            CHECK(change.insertions == std::vector<uint64_t>({0, 1, 2}));
+        }
+#endif
+
+        SECTION("results_notifications_coalesced_key_paths") {
+            auto realm = db(std::move(config));
+            auto managed_obj = realm.write([&realm] {
+                AllTypesObject o;
+                o._id = 1;
+                return realm.add(std::move(o));
+            });
+
+            int callback_count = 0;
+            results<AllTypesObject>::results_change change;
+            auto results = realm.objects<AllTypesObject>();
+            notification_options options;
+            options.max_pending_commits = 2;
+            auto token = results.observe([&](auto&& c) {
+                callback_count++;
+                change = std::move(c);
+            }, {"str_col"}, options);
+            realm.refresh();
+            CHECK(callback_count == 1);
+
+            realm.write([&managed_obj] {
+                managed_obj.double_col = 1.5;
+            });
+            realm.refresh();
+            CHECK(callback_count == 1);
+
+            realm.write([&managed_obj] {
+                managed_obj.str_col = "foo";
+            });
+            realm.refresh();
+            CHECK(callback_count == 1);
+            realm.write([&managed_obj] {
+                managed_obj.str_col = "bar";
+            });
+            realm.refresh();
+            CHECK(callback_count == 2);
+            CHECK(change.modifications == std::vector<uint64_t>({0}));
+        }
+
         managed<AllTypesObject> test_obj;
 
         SECTION("results_subscript") {
@@ -494,3 +494,92 @@ TEST_CASE("run loops", "[run loops]") {
     }
 }
 #endif
+
+#if defined(__linux__)
+TEST_CASE("event loop scheduler", "[run loops]") {
+    realm_path path;
+
+    SECTION("invoke from many threads") {
+        auto scheduler = std::make_shared<realm::event_loop_scheduler>();
+        int count = 0;
+        std::vector<std::thread> producers;
+        for (int t = 0; t < 4; t++) {
+            producers.emplace_back([&scheduler, &count] {
+                for (int i = 0; i < 1000; i++) {
+                    scheduler->invoke([&count] { count++; });
+                }
+            });
+        }
+        for (auto& t : producers) {
+            t.join();
+        }
+        while (scheduler->run_once()) {}
+        CHECK(count == 4000);
+        CHECK_FALSE(scheduler->run_once(std::chrono::milliseconds(10)));
+    }
+
+    SECTION("run after stop") {
+        auto scheduler = std::make_shared<realm::event_loop_scheduler>();
+        scheduler->stop();
+        int count = 0;
+        scheduler->invoke([&] {
+            count++;
+            scheduler->stop();
+        });
+        scheduler->run();
+        CHECK(count == 1);
+    }
+
+    SECTION("last reference released on owned thread") {
+        auto scheduler = std::make_shared<realm::event_loop_scheduler>();
+        scheduler->start();
+        std::promise<void> released;
+        std::weak_ptr<realm::event_loop_scheduler> weak = scheduler;
+        scheduler->invoke([s = std::move(scheduler), &released]() mutable {
+            s.reset();
+            released.set_value();
+        });
+        REQUIRE(released.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        CHECK(weak.expired());
+    }
+
+    SECTION("notifications on owned thread") {
+        auto scheduler = std::make_shared<realm::event_loop_scheduler>();
+        scheduler->start();
+
+        std::promise<bool> delivered;
+        std::optional<realm::experimental::db> db;
+        std::optional<realm::experimental::managed<realm::experimental::AllTypesObject>> managed_obj;
+        realm::notification_token token;
+        scheduler->invoke([&] {
+            CHECK(scheduler->is_on_thread());
+            db.emplace(realm::db_config(path, scheduler));
+            managed_obj = db->write([&] {
+                return db->add(realm::experimental::AllTypesObject());
+            });
+            token = managed_obj->observe([&](auto&& change) {
+                if (!change.property_changes.empty()) {
+                    delivered.set_value(true);
+                }
+            });
+            db->write([&] {
+                managed_obj->str_col = "456";
+            });
+        });
+
+        auto future = delivered.get_future();
+        REQUIRE(future.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        CHECK(future.get());
+
+        std::promise<void> closed;
+        scheduler->invoke([&] {
+            token.unregister();
+            managed_obj.reset();
+            db.reset();
+            closed.set_value();
+        });
+        closed.get_future().wait();
+        scheduler->stop();
+    }
+}
+#endif
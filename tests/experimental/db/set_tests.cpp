@@ -355,6 +355,51 @@ TEST_CASE("set", "[set]") {
         CHECK(managed_obj.set_int_col.detach() == std::set<int64_t>({1}));
     }
 
+    SECTION("set_algebra") {
+        auto realm = realm::experimental::db(std::move(config));
+        auto obj1 = realm::experimental::AllTypesObject();
+        obj1._id = 1;
+        obj1.set_int_col = {1, 2, 3};
+        auto obj2 = realm::experimental::AllTypesObject();
+        obj2._id = 2;
+        obj2.set_int_col = {2, 3, 4};
+
+        auto managed_obj1 = realm.write([&]() {
+            return realm.add(std::move(obj1));
+        });
+        auto managed_obj2 = realm.write([&]() {
+            return realm.add(std::move(obj2));
+        });
+
+        CHECK(managed_obj1.set_int_col.intersects(managed_obj2.set_int_col));
+        CHECK_FALSE(managed_obj1.set_int_col.is_subset_of(managed_obj2.set_int_col));
+        CHECK_FALSE(managed_obj1.set_int_col.set_equals(managed_obj2.set_int_col));
+
+        realm.write([&]() {
+            CHECK(managed_obj1.set_int_col.intersect(managed_obj2.set_int_col) == 2);
+        });
+        CHECK(managed_obj1.set_int_col.detach() == std::set<int64_t>({2, 3}));
+        CHECK(managed_obj1.set_int_col.is_subset_of(managed_obj2.set_int_col));
+        CHECK(managed_obj2.set_int_col.is_superset_of(managed_obj1.set_int_col));
+
+        realm.write([&]() {
+            CHECK(managed_obj1.set_int_col.union_with(managed_obj2.set_int_col) == 3);
+        });
+        CHECK(managed_obj1.set_int_col.set_equals(managed_obj2.set_int_col));
+
+        realm.write([&]() {
+            managed_obj1.set_int_col.insert(5);
+            CHECK(managed_obj1.set_int_col.difference(managed_obj2.set_int_col) == 1);
+        });
+        CHECK(managed_obj1.set_int_col.detach() == std::set<int64_t>({5}));
+        CHECK_FALSE(managed_obj1.set_int_col.intersects(managed_obj2.set_int_col));
+
+        realm.write([&]() {
+            CHECK(managed_obj1.set_int_col.symmetric_difference(managed_obj2.set_int_col) == 4);
+        });
+        CHECK(managed_obj1.set_int_col.detach() == std::set<int64_t>({2, 3, 4, 5}));
+    }
+
     SECTION("iterator") {
         auto realm = realm::experimental::db(std::move(config));
         auto obj = realm::experimental::AllTypesObject();
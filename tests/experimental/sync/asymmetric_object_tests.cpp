@@ -28,4 +28,75 @@ TEST_CASE("asymmetric object", "[sync_beta]") {
         CHECK(arr.size() == 1);
         CHECK(bson::BsonDocument(arr[0])["_id"].operator ObjectId().to_string() == oid.to_string());
     }
+
+    SECTION("ingest", "[sync]") {
+        auto asymmetric_app_id = Admin::shared().create_app({}, "test", true);
+        auto app = realm::App(realm::App::configuration({asymmetric_app_id, Admin::shared().base_url()}));
+        auto user = app.login(realm::App::credentials::anonymous()).get();
+        auto synced_realm = experimental::open<experimental::AllTypesAsymmetricObject, experimental::EmbeddedFoo>(user.flexible_sync_configuration());
+
+        std::vector<experimental::AllTypesAsymmetricObject> objs(25);
+        for (auto& o : objs) {
+            o._id = realm::object_id::generate();
+        }
+        synced_realm.ingest(objs, 10);
+
+        // Inside a write, the objects join the open write transaction.
+        std::vector<experimental::AllTypesAsymmetricObject> more(5);
+        for (auto& o : more) {
+            o._id = realm::object_id::generate();
+        }
+        synced_realm.write([&] {
+            synced_realm.ingest(more, 2);
+        });
+
+        test::wait_for_sync_uploads(user).get();
+        test::wait_for_sync_downloads(user).get();
+
+        auto result = user.call_function("asymmetricSyncData", bson::BsonArray({bson::BsonDocument{{"_id", objs.back()._id.to_string()}}})).get();
+        CHECK(result);
+        auto arr = bson::BsonArray(*result);
+        CHECK(arr.size() == 1);
+
+        result = user.call_function("asymmetricSyncData", bson::BsonArray({bson::BsonDocument{{"_id", more.back()._id.to_string()}}})).get();
+        CHECK(result);
+        CHECK(bson::BsonArray(*result).size() == 1);
+    }
+}
+
+TEST_CASE("asymmetric ingest performance", "[sync][performance]") {
+    auto asymmetric_app_id = Admin::shared().create_app({}, "test", true);
+    auto app = realm::App(realm::App::configuration({asymmetric_app_id, Admin::shared().base_url()}));
+    auto user = app.login(realm::App::credentials::anonymous()).get();
+    auto synced_realm = experimental::open<experimental::AllTypesAsymmetricObject, experimental::EmbeddedFoo>(user.flexible_sync_configuration());
+
+    auto make_events = [] {
+        std::vector<experimental::AllTypesAsymmetricObject> events(10000);
+        for (auto& e : events) {
+            e._id = realm::object_id::generate();
+        }
+        return events;
+    };
+
+    BENCHMARK_ADVANCED("add 10000 events")(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<experimental::AllTypesAsymmetricObject>> runs(meter.runs());
+        std::generate(runs.begin(), runs.end(), make_events);
+        meter.measure([&](int i) {
+            synced_realm.write([&] {
+                for (auto& e : runs[i]) {
+                    synced_realm.add(std::move(e));
+                }
+            });
+            test::wait_for_sync_uploads(user).get();
+        });
+    };
+
+    BENCHMARK_ADVANCED("ingest 10000 events")(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<experimental::AllTypesAsymmetricObject>> runs(meter.runs());
+        std::generate(runs.begin(), runs.end(), make_events);
+        meter.measure([&](int i) {
+            synced_realm.ingest(runs[i]);
+            test::wait_for_sync_uploads(user).get();
+        });
+    };
 }
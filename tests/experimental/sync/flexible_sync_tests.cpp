@@ -101,6 +101,119 @@ TEST_CASE("flexible_sync_beta", "[sync]") {
         auto flx_sync_config2 = user.flexible_sync_configuration();
         REQUIRE_THROWS(experimental::db(flx_sync_config2));
     }
+
+    SECTION("reconcile subscriptions") {
+        auto user = app.login(realm::App::credentials::anonymous()).get();
+        auto synced_realm = experimental::db(user.flexible_sync_configuration());
+        auto declare = [](realm::mutable_sync_subscription_set &subs) {
+            subs.add<experimental::AllTypesObject>("foo-strings", [](auto &obj) {
+                return obj.str_col == "foo";
+            });
+            subs.add<experimental::AllTypesObjectLink>("foo-link");
+        };
+
+        auto diff = synced_realm.subscriptions().reconcile(declare).get();
+        CHECK(diff.complete);
+        CHECK(diff.added == std::vector<std::string>{"foo-link", "foo-strings"});
+        CHECK(diff.removed.empty());
+        CHECK(synced_realm.subscriptions().size() == 2);
+        auto created_at = synced_realm.subscriptions().find("foo-strings")->created_at;
+
+        // Re-applying the same declaration commits nothing.
+        diff = synced_realm.subscriptions().reconcile(declare).get();
+        CHECK(diff.empty());
+        CHECK(synced_realm.subscriptions().find("foo-strings")->created_at == created_at);
+
+        diff = synced_realm.subscriptions().reconcile([](realm::mutable_sync_subscription_set &subs) {
+            subs.add<experimental::AllTypesObject>("foo-strings", [](auto &obj) {
+                return obj.str_col == "bar";
+            });
+        }).get();
+        CHECK(diff.added.empty());
+        CHECK(diff.removed == std::vector<std::string>{"foo-link"});
+        CHECK(diff.updated == std::vector<std::string>{"foo-strings"});
+        CHECK(synced_realm.subscriptions().size() == 1);
+    }
+
+    SECTION("progress notifications") {
+        auto user = app.login(realm::App::credentials::anonymous()).get();
+        auto synced_realm = experimental::db(user.flexible_sync_configuration());
+        synced_realm.subscriptions().update([](realm::mutable_sync_subscription_set &subs) {
+            subs.add<experimental::AllTypesObject>("all");
+        }).get();
+
+        // A session without a scheduler delivers progress on the sync client's thread.
+        auto session = internal::bridge::sync_session(user.m_user->sync_manager()->get_all_sessions()[0]);
+        CHECK(session.get_throughput().uploaded_bytes == 0);
+
+        std::promise<internal::bridge::sync_session::progress> completed;
+        bool done = false;
+        auto token = session.register_progress_notifier(internal::bridge::sync_session::progress_direction::upload,
+                                                        internal::bridge::sync_session::progress_mode::streaming,
+                                                        [&](const internal::bridge::sync_session::progress& p) {
+            if (!done && p.transferred_bytes > 0 && p.is_complete()) {
+                done = true;
+                completed.set_value(p);
+            }
+        });
+
+        synced_realm.write([&synced_realm]() {
+            experimental::AllTypesObject o;
+            o._id = 4242;
+            o.str_col = std::string(16 * 1024, 'x');
+            synced_realm.add(std::move(o));
+        });
+        test::wait_for_sync_uploads(user).get();
+
+        auto p = completed.get_future().get();
+        CHECK(p.estimate == 1.0);
+        session.unregister_progress_notifier(token);
+        CHECK(session.get_throughput().uploaded_bytes > 0);
+    }
+
+    SECTION("pause and resume") {
+        auto user = app.login(realm::App::credentials::anonymous()).get();
+        auto synced_realm = experimental::db(user.flexible_sync_configuration());
+        auto session = *synced_realm.get_sync_session();
+        session.pause();
+        CHECK(session.state() == internal::bridge::sync_session::state::paused);
+        session.resume();
+        CHECK(session.state() != internal::bridge::sync_session::state::paused);
+        session.reconnect();
+        test::wait_for_sync_downloads(user).get();
+    }
+}
+
+TEST_CASE("sync_write_performance", "[sync][performance]") {
+    auto app = realm::App(realm::App::configuration({Admin::shared().cached_app_id(), Admin::shared().base_url()}));
+    auto user = app.login(realm::App::credentials::anonymous()).get();
+    auto synced_realm = experimental::db(user.flexible_sync_configuration());
+    synced_realm.subscriptions().update([](realm::mutable_sync_subscription_set &subs) {
+        subs.add<experimental::AllTypesObject>("all");
+    }).get();
+    auto session = *synced_realm.get_sync_session();
+    int64_t next_id = 100000;
+
+    auto write_1000 = [&] {
+        for (int i = 0; i < 1000; i++) {
+            synced_realm.write([&] {
+                experimental::AllTypesObject o;
+                o._id = next_id++;
+                synced_realm.add(std::move(o));
+            });
+        }
+    };
+
+    BENCHMARK("1000 writes with sync active") {
+        write_1000();
+    };
+
+    session.pause();
+    BENCHMARK("1000 writes with sync paused") {
+        write_1000();
+    };
+    session.resume();
+    test::wait_for_sync_uploads(user).get();
 }
 
 template<typename T, typename Func>
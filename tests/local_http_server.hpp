@@ -0,0 +1,211 @@
+#ifndef CPPREALM_TESTS_LOCAL_HTTP_SERVER_HPP
+#define CPPREALM_TESTS_LOCAL_HTTP_SERVER_HPP
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A minimal HTTP/1.1 server on the loopback interface, used to exercise the network
+// transports without a real App Services deployment. Connections are kept alive and
+// every request is answered by `handler`, which defaults to `200 OK` with an empty JSON body.
+class local_http_server {
+public:
+    struct response {
+        int status = 200;
+        std::string body = "{}";
+    };
+    using handler_t = std::function<response(const std::string& method, const std::string& path, const std::string& body)>;
+
+    // Listens on `port`, or on any free port if it is 0.
+    explicit local_http_server(handler_t handler = {}, uint16_t port = 0)
+        : m_handler(std::move(handler)) {
+        m_listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (m_listen_fd < 0) {
+            throw std::runtime_error("local_http_server: socket() failed");
+        }
+        int yes = 1;
+        ::setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(port);
+        if (::bind(m_listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(m_listen_fd, 128) != 0) {
+            ::close(m_listen_fd);
+            throw std::runtime_error("local_http_server: bind()/listen() failed");
+        }
+        socklen_t len = sizeof(addr);
+        ::getsockname(m_listen_fd, reinterpret_cast<sockaddr*>(&addr), &len);
+        m_port = ntohs(addr.sin_port);
+        m_accept_thread = std::thread([this] { accept_loop(); });
+    }
+
+    ~local_http_server() {
+        m_stopped = true;
+        ::shutdown(m_listen_fd, SHUT_RDWR);
+        ::close(m_listen_fd);
+        m_accept_thread.join();
+        std::vector<std::thread> threads;
+        {
+            std::lock_guard lock(m_mutex);
+            for (int fd : m_connection_fds) {
+                ::shutdown(fd, SHUT_RDWR);
+            }
+            threads.swap(m_connection_threads);
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    local_http_server(const local_http_server&) = delete;
+    local_http_server& operator=(const local_http_server&) = delete;
+
+    [[nodiscard]] uint16_t port() const { return m_port; }
+
+    [[nodiscard]] std::string url(const std::string& path = "/") const {
+        return "http://127.0.0.1:" + std::to_string(m_port) + path;
+    }
+
+    [[nodiscard]] size_t connections_accepted() const { return m_connections_accepted; }
+    [[nodiscard]] size_t requests_served() const { return m_requests_served; }
+    // Closes every open connection, as a server does with keep-alive connections that have
+    // been idle for too long.
+    void close_connections() {
+        std::lock_guard lock(m_mutex);
+        for (int fd : m_connection_fds) {
+            ::shutdown(fd, SHUT_RDWR);
+        }
+    }
+
+    // The most requests the handler has been running at once.
+    [[nodiscard]] size_t peak_requests_in_flight() const { return m_peak_requests_in_flight; }
+
+private:
+    void accept_loop() {
+        while (!m_stopped) {
+            int fd = ::accept(m_listen_fd, nullptr, nullptr);
+            if (fd < 0) {
+                if (m_stopped) {
+                    break;
+                }
+                if (errno == EINTR || errno == ECONNABORTED) {
+                    continue;
+                }
+                if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+                    // Out of descriptors or memory: give open connections time to close.
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    continue;
+                }
+                break;
+            }
+            m_connections_accepted++;
+            std::lock_guard lock(m_mutex);
+            m_connection_fds.push_back(fd);
+            m_connection_threads.emplace_back([this, fd] { serve(fd); });
+        }
+    }
+
+    void serve(int fd) {
+        std::string buffer;
+        char chunk[16 * 1024];
+        while (true) {
+            auto header_end = buffer.find("\r\n\r\n");
+            if (header_end == std::string::npos) {
+                auto n = ::recv(fd, chunk, sizeof(chunk), 0);
+                if (n <= 0) {
+                    break;
+                }
+                buffer.append(chunk, static_cast<size_t>(n));
+                continue;
+            }
+            auto headers = buffer.substr(0, header_end);
+            size_t content_length = 0;
+            if (auto pos = find_header(headers, "content-length:"); pos != std::string::npos) {
+                content_length = std::stoul(headers.substr(pos + 15));
+            }
+            while (buffer.size() < header_end + 4 + content_length) {
+                auto n = ::recv(fd, chunk, sizeof(chunk), 0);
+                if (n <= 0) {
+                    close_connection(fd);
+                    return;
+                }
+                buffer.append(chunk, static_cast<size_t>(n));
+            }
+            auto request_line = headers.substr(0, headers.find("\r\n"));
+            auto method = request_line.substr(0, request_line.find(' '));
+            auto path_start = request_line.find(' ') + 1;
+            auto path = request_line.substr(path_start, request_line.find(' ', path_start) - path_start);
+            auto body = buffer.substr(header_end + 4, content_length);
+            buffer.erase(0, header_end + 4 + content_length);
+
+            auto in_flight = ++m_requests_in_flight;
+            auto peak = m_peak_requests_in_flight.load();
+            while (in_flight > peak && !m_peak_requests_in_flight.compare_exchange_weak(peak, in_flight)) {
+            }
+            auto r = m_handler ? m_handler(method, path, body) : response{};
+            m_requests_in_flight--;
+            auto out = "HTTP/1.1 " + std::to_string(r.status) + " OK\r\n"
+                       "Content-Type: application/json\r\n"
+                       "Content-Length: " + std::to_string(r.body.size()) + "\r\n"
+                       "Connection: keep-alive\r\n\r\n" + r.body;
+            size_t sent = 0;
+            while (sent < out.size()) {
+                auto n = ::send(fd, out.data() + sent, out.size() - sent, MSG_NOSIGNAL);
+                if (n <= 0) {
+                    close_connection(fd);
+                    return;
+                }
+                sent += static_cast<size_t>(n);
+            }
+            m_requests_served++;
+        }
+        close_connection(fd);
+    }
+
+    static size_t find_header(const std::string& headers, const std::string& lower_name) {
+        std::string lower(headers.size(), '\0');
+        for (size_t i = 0; i < headers.size(); i++) {
+            lower[i] = static_cast<char>(::tolower(static_cast<unsigned char>(headers[i])));
+        }
+        return lower.find(lower_name);
+    }
+
+    void close_connection(int fd) {
+        std::lock_guard lock(m_mutex);
+        for (auto it = m_connection_fds.begin(); it != m_connection_fds.end(); ++it) {
+            if (*it == fd) {
+                m_connection_fds.erase(it);
+                break;
+            }
+        }
+        ::close(fd);
+    }
+
+    handler_t m_handler;
+    int m_listen_fd = -1;
+    uint16_t m_port = 0;
+    std::atomic<bool> m_stopped = false;
+    std::atomic<size_t> m_connections_accepted = 0;
+    std::atomic<size_t> m_requests_served = 0;
+    std::atomic<size_t> m_requests_in_flight = 0;
+    std::atomic<size_t> m_peak_requests_in_flight = 0;
+    std::thread m_accept_thread;
+    std::mutex m_mutex;
+    std::vector<int> m_connection_fds;
+    std::vector<std::thread> m_connection_threads;
+};
+
+#endif //CPPREALM_TESTS_LOCAL_HTTP_SERVER_HPP